@@ -0,0 +1,95 @@
+/*
+ * File: benchmark_main.cpp
+ *
+ * Brief: Entry point for the benchmark suite. Benchmarks are written as Catch
+ *        test cases so they can be filtered by tag, e.g. run_benchmarks [scaling]
+ *
+ *        Also registers a json reporter, selected with -r json, that writes
+ *        every benchmark's name, test case, iterations and timings as one 
+ *        JSON document so results can be compared between releases.
+ *
+ * https://github.com/catchorg/Catch2/blob/master/docs/slow-compiles.md#top
+ */
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <cstdio> // std::snprintf
+
+namespace
+{
+    // Quotes and escapes a string for a JSON document
+    std::string json_string(const std::string& text)
+    {
+        std::string quoted = "\"";
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+            {
+                quoted += '\\';
+                quoted += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                quoted += escaped;
+            }
+            else
+            {
+                quoted += c;
+            }
+        }
+        return quoted + "\"";
+    }
+}
+
+struct json_reporter : Catch::StreamingReporterBase<json_reporter>
+{
+    using StreamingReporterBase::StreamingReporterBase;
+
+    static std::string getDescription()
+    {
+        return "Reports each benchmark's timings as JSON";
+    }
+
+    void testRunStarting(const Catch::TestRunInfo& info) override
+    {
+        StreamingReporterBase::testRunStarting(info);
+        stream << "{\n  \"run\": " << json_string(info.name) 
+               << ",\n  \"benchmarks\": [";
+    }
+
+    void assertionStarting(const Catch::AssertionInfo&) override {}
+
+    bool assertionEnded(const Catch::AssertionStats& stats) override
+    {
+        if (!stats.assertionResult.isOk())
+        {
+            ++failed_assertions;
+        }
+        return true;
+    }
+
+    void benchmarkEnded(const Catch::BenchmarkStats& stats) override
+    {
+        stream << (benchmarks++ == 0 ? "\n" : ",\n")
+               << "    { \"name\": " << json_string(stats.info.name)
+               << ", \"test_case\": " << json_string(currentTestCaseInfo->name)
+               << ", \"iterations\": " << stats.iterations
+               << ", \"total_ns\": " << stats.elapsedTimeInNanoseconds
+               << ", \"average_ns\": " 
+               << stats.elapsedTimeInNanoseconds / stats.iterations << " }";
+    }
+
+    void testRunEnded(const Catch::TestRunStats& stats) override
+    {
+        stream << "\n  ],\n  \"failed_assertions\": " << failed_assertions << "\n}\n";
+        StreamingReporterBase::testRunEnded(stats);
+    }
+
+    std::size_t benchmarks = 0;
+    std::size_t failed_assertions = 0;
+};
+
+CATCH_REGISTER_REPORTER("json", json_reporter)
@@ -0,0 +1,80 @@
+/*
+ 
+ File: compact_linked_list_benchmark.cpp
+
+ Brief: Compares iteration, remove_if and sort throughput of the 
+        compact_linked_list against the linear_linked_list.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <random>
+#include <catch.hpp>
+#include "linear_linked_list.hpp"
+#include "compact_linked_list.hpp"
+
+namespace
+{
+    const int elements = 1000000;
+
+    template <class List>
+    List random_compact_input(unsigned seed)
+    {
+        std::mt19937 engine(seed);
+        List list;
+        for (int i = 0; i < elements; ++i)
+        {
+            list.push_back(static_cast<int>(engine()));
+        }
+        return list;
+    }
+
+    template <class List>
+    void run_compact_benchmarks(const char* iterate, const char* remove, const char* sort)
+    {
+        List list = random_compact_input<List>(7);
+
+        long long sum = 0;
+        BENCHMARK(iterate)
+        {
+            for (int value : list)
+            {
+                sum += value;
+            }
+        }
+        REQUIRE(sum != 0);
+
+        List sortable = list;
+        BENCHMARK(sort)
+        {
+            sortable.sort();
+        }
+
+        int removed = 0;
+        BENCHMARK(remove)
+        {
+            removed += list.remove_if([](int n){ return n % 2 == 0; });
+        }
+        REQUIRE(removed > 0);
+    }
+}
+
+TEST_CASE("Compact and linear lists of 10^6 ints", "[compact]")
+{
+    run_compact_benchmarks<linear_linked_list<int>>(
+        "iterate, linear_linked_list<int>", 
+        "remove_if, linear_linked_list<int>", 
+        "sort, linear_linked_list<int>");
+
+    run_compact_benchmarks<compact_linked_list<int>>(
+        "iterate, compact_linked_list<int>", 
+        "remove_if, compact_linked_list<int>", 
+        "sort, compact_linked_list<int>");
+}
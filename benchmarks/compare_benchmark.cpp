@@ -0,0 +1,375 @@
+/*
+
+ File: compare_benchmark.cpp
+
+ Brief: Measures linear_linked_list against std::forward_list, std::list,
+        std::deque and std::vector. Construction, push_front, push_back,
+        pop_front, iteration, remove_if, reverse, sort, merge, copy and
+        destruction are each timed at 10, 10^3, 10^5 and 10^7 elements of
+        int, std::string and a 32 byte record. Operations a container has
+        no efficient form of, like push_front on a vector, are skipped.
+
+        Every benchmark is named container/element/operation/size, so the
+        results can be split into columns. Run with -r json to write them
+        as JSON, e.g. run_benchmarks_release [compare] -r json -o out.json
+
+        Each measurement repeats the operation on a freshly built container
+        until 10^6 elements have been processed, timing only the operation.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <list>
+#include <deque>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <forward_list>
+
+// Exposes BenchmarkInfo and BenchmarkStats, which measure reports through
+#define CATCH_CONFIG_EXTERNAL_INTERFACES
+#include <catch.hpp>
+#include "linear_linked_list.hpp"
+
+namespace
+{
+    // A record larger than a pointer, ordered by its key
+    struct record
+    {
+        explicit record(int key = 0) : key(key)
+        {
+            std::fill(payload, payload + sizeof(payload), static_cast<char>(key));
+        }
+
+        bool operator<(const record& rhs) const { return key < rhs.key; }
+        bool operator==(const record& rhs) const { return key == rhs.key; }
+
+        int key;
+        char payload[28];
+    };
+
+    template <typename T> T make(int key);
+    template <> int make<int>(int key) { return key; }
+    template <> std::string make<std::string>(int key) { return std::to_string(key); }
+    template <> record make<record>(int key) { return record(key); }
+
+    int key(int element) { return element; }
+    int key(const std::string& element) { return element.back() - '0'; }
+    int key(const record& element) { return element.key; }
+
+    template <typename T> const char* element_name();
+    template <> const char* element_name<int>() { return "int"; }
+    template <> const char* element_name<std::string>() { return "std::string"; }
+    template <> const char* element_name<record>() { return "record"; }
+
+    /*
+    Names each container and whether it has constant time operations at its
+    front and back. A vector has no push_front, and a forward_list has no
+    push_back, so those operations are not measured for them
+    */
+    template <class C> struct container_traits;
+
+    template <typename T> struct container_traits<linear_linked_list<T>>
+    {
+        static const char* name() { return "linear_linked_list"; }
+        typedef std::true_type front;
+        typedef std::true_type back;
+    };
+
+    template <typename T> struct container_traits<std::forward_list<T>>
+    {
+        static const char* name() { return "std::forward_list"; }
+        typedef std::true_type front;
+        typedef std::false_type back;
+    };
+
+    template <typename T> struct container_traits<std::list<T>>
+    {
+        static const char* name() { return "std::list"; }
+        typedef std::true_type front;
+        typedef std::true_type back;
+    };
+
+    template <typename T> struct container_traits<std::deque<T>>
+    {
+        static const char* name() { return "std::deque"; }
+        typedef std::true_type front;
+        typedef std::true_type back;
+    };
+
+    template <typename T> struct container_traits<std::vector<T>>
+    {
+        static const char* name() { return "std::vector"; }
+        typedef std::false_type front;
+        typedef std::true_type back;
+    };
+
+    /* Operations, overloaded where a container spells them differently */
+
+    template <class C, class Predicate>
+    void remove_if(C& container, Predicate pred) { container.remove_if(pred); }
+
+    template <class C>
+    void reverse(C& container) { container.reverse(); }
+
+    template <class C>
+    void sort(C& container) { container.sort(); }
+
+    template <class C>
+    void merge(C& container, C& other) { container.merge(other); }
+
+    template <class C, class Predicate>
+    void erase_if(C& container, Predicate pred)
+    {
+        container.erase(std::remove_if(container.begin(), container.end(), pred),
+                        container.end());
+    }
+
+    template <typename T, class Predicate>
+    void remove_if(std::deque<T>& container, Predicate pred) { erase_if(container, pred); }
+
+    template <typename T, class Predicate>
+    void remove_if(std::vector<T>& container, Predicate pred) { erase_if(container, pred); }
+
+    template <typename T>
+    void reverse(std::deque<T>& container) { std::reverse(container.begin(), container.end()); }
+
+    template <typename T>
+    void reverse(std::vector<T>& container) { std::reverse(container.begin(), container.end()); }
+
+    template <typename T>
+    void sort(std::deque<T>& container) { std::sort(container.begin(), container.end()); }
+
+    template <typename T>
+    void sort(std::vector<T>& container) { std::sort(container.begin(), container.end()); }
+
+    template <class C>
+    void merge_sequence(C& container, C& other)
+    {
+        std::size_t middle = container.size();
+        container.insert(container.end(), other.begin(), other.end());
+        other.clear();
+        std::inplace_merge(container.begin(), container.begin() + middle, container.end());
+    }
+
+    template <typename T>
+    void merge(std::deque<T>& container, std::deque<T>& other) { merge_sequence(container, other); }
+
+    template <typename T>
+    void merge(std::vector<T>& container, std::vector<T>& other) { merge_sequence(container, other); }
+
+    // Keeps results alive so that the optimizer cannot remove the work
+    volatile long long sink = 0;
+
+    typedef std::chrono::steady_clock clock;
+
+    /*
+    Times op(*state) on a fresh state from setup until 10^6 elements have been
+    processed, then reports the total through Catch like a BENCHMARK would
+    */
+    template <class Setup, class Operation>
+    void measure(const std::string& name, std::size_t size, Setup setup, Operation op)
+    {
+        const std::size_t repeats = std::max<std::size_t>(1, 1000000 / size);
+        std::uint64_t elapsed = 0;
+
+        for (std::size_t i = 0; i < repeats; ++i)
+        {
+            auto state = setup();
+
+            clock::time_point start = clock::now();
+            op(state);
+            elapsed += static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    clock::now() - start).count());
+        }
+
+        Catch::getResultCapture().benchmarkStarting({ name });
+        Catch::getResultCapture().benchmarkEnded({ { name }, repeats, elapsed });
+    }
+
+    template <class C, class Setup>
+    void measure_front(const std::string& prefix, const std::string& suffix, 
+                       std::size_t size, const std::vector<typename C::value_type>& elements,
+                       Setup empty, Setup filled, std::true_type)
+    {
+        measure(prefix + "push_front" + suffix, size, empty, 
+            [&elements](std::unique_ptr<C>& container)
+        {
+            for (const typename C::value_type& element : elements)
+            {
+                container->push_front(element);
+            }
+        });
+
+        measure(prefix + "pop_front" + suffix, size, filled, [](std::unique_ptr<C>& container)
+        {
+            while (!container->empty())
+            {
+                container->pop_front();
+            }
+        });
+    }
+
+    template <class C, class Setup>
+    void measure_front(const std::string&, const std::string&, std::size_t, 
+                       const std::vector<typename C::value_type>&, Setup, Setup, 
+                       std::false_type) {}
+
+    template <class C, class Setup>
+    void measure_back(const std::string& prefix, const std::string& suffix, 
+                      std::size_t size, const std::vector<typename C::value_type>& elements,
+                      Setup empty, std::true_type)
+    {
+        measure(prefix + "push_back" + suffix, size, empty, 
+            [&elements](std::unique_ptr<C>& container)
+        {
+            for (const typename C::value_type& element : elements)
+            {
+                container->push_back(element);
+            }
+        });
+    }
+
+    template <class C, class Setup>
+    void measure_back(const std::string&, const std::string&, std::size_t, 
+                      const std::vector<typename C::value_type>&, Setup, std::false_type) {}
+
+    template <class C>
+    void compare(std::size_t size)
+    {
+        typedef typename C::value_type value_type;
+        typedef std::unique_ptr<C> pointer;
+        typedef std::pair<C, C> pair;
+
+        // Sorted, shuffled, and split into the sorted even and odd keys
+        std::vector<value_type> sorted;
+        std::vector<value_type> evens;
+        std::vector<value_type> odds;
+        for (int i = 0; i < static_cast<int>(size); ++i)
+        {
+            sorted.push_back(make<value_type>(i));
+            (i % 2 == 0 ? evens : odds).push_back(sorted.back());
+        }
+        std::vector<value_type> shuffled = sorted;
+        std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(2018));
+
+        const std::string prefix = std::string(container_traits<C>::name()) + "/"
+                                 + element_name<value_type>() + "/";
+        const std::string suffix = "/" + std::to_string(size);
+
+        std::function<pointer()> empty = []() { return pointer(new C()); };
+        std::function<pointer()> filled = [&sorted]() 
+        { 
+            return pointer(new C(sorted.begin(), sorted.end())); 
+        };
+        auto unsorted = [&shuffled]() { return pointer(new C(shuffled.begin(), shuffled.end())); };
+        auto halves = [&evens, &odds]()
+        {
+            return std::unique_ptr<pair>(new pair(C(evens.begin(), evens.end()),
+                                                  C(odds.begin(), odds.end())));
+        };
+
+        measure(prefix + "construct" + suffix, size, []() { return pointer(); },
+            [&sorted](pointer& container)
+        {
+            container.reset(new C(sorted.begin(), sorted.end()));
+        });
+
+        measure_front<C>(prefix, suffix, size, sorted, empty, filled, 
+                         typename container_traits<C>::front());
+        measure_back<C>(prefix, suffix, size, sorted, empty, 
+                        typename container_traits<C>::back());
+
+        measure(prefix + "iterate" + suffix, size, filled, [](pointer& container)
+        {
+            long long sum = 0;
+            for (const value_type& element : *container)
+            {
+                sum += key(element);
+            }
+            sink = sum;
+        });
+
+        measure(prefix + "remove_if" + suffix, size, filled, [](pointer& container)
+        {
+            remove_if(*container, [](const value_type& element){ return key(element) % 3 == 0; });
+        });
+
+        measure(prefix + "reverse" + suffix, size, filled, [](pointer& container)
+        {
+            reverse(*container);
+        });
+
+        measure(prefix + "sort" + suffix, size, unsorted, [](pointer& container)
+        {
+            sort(*container);
+        });
+
+        measure(prefix + "merge" + suffix, size, halves, [](std::unique_ptr<pair>& lists)
+        {
+            merge(lists->first, lists->second);
+        });
+
+        // The copy is kept until the next setup, so its destruction is not timed
+        pointer copy;
+        measure(prefix + "copy" + suffix, size, [&filled, &copy]() -> pointer
+        {
+            copy.reset();
+            return filled();
+        },
+            [&copy](pointer& container)
+        {
+            copy.reset(new C(*container));
+        });
+        copy.reset();
+
+        measure(prefix + "destroy" + suffix, size, filled, [](pointer& container)
+        {
+            container.reset();
+        });
+    }
+
+    template <typename T>
+    void compare_containers()
+    {
+        const std::size_t sizes[] = { 10, 1000, 100000, 10000000 };
+
+        for (std::size_t size : sizes)
+        {
+            compare<linear_linked_list<T>>(size);
+            compare<std::forward_list<T>>(size);
+            compare<std::list<T>>(size);
+            compare<std::deque<T>>(size);
+            compare<std::vector<T>>(size);
+        }
+    }
+}
+
+TEST_CASE("Comparing containers of int", "[compare], [compare_int]")
+{
+    compare_containers<int>();
+}
+
+TEST_CASE("Comparing containers of std::string", "[compare], [compare_string]")
+{
+    compare_containers<std::string>();
+}
+
+TEST_CASE("Comparing containers of 32 byte records", "[compare], [compare_record]")
+{
+    compare_containers<record>();
+}
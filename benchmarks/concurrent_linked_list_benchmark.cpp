@@ -0,0 +1,174 @@
+/*
+
+ File: concurrent_linked_list_benchmark.cpp
+
+ Brief: Compares the throughput of a concurrent_linked_list with a
+        linear_linked_list guarded by a single std::mutex. A list of 1000
+        ints is searched, inserted into and erased from by 1, 2 and 4
+        threads doing 10^5 operations in total. Three mixes are measured:
+        90% finds, 50% finds and 10% finds, the rest split evenly between
+        insert_after and erase_after around a random element.
+
+        NOTE: Contention only shows with the threads on separate cores. On a
+        single core the threads take turns and the results mostly measure
+        the cost of each operation, where the per node locks of the
+        concurrent list cost more than one lock around the whole search.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <catch.hpp>
+#include "linear_linked_list.hpp"
+#include "concurrent_linked_list.hpp"
+
+namespace
+{
+    const int list_elements = 1000;
+    const int operations = 100000;
+
+    // The shared list a concurrent_linked_list replaces
+    class locked_list
+    {
+      public:
+
+        void push_front(int num)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            list.push_front(num);
+        }
+
+        bool find(int target)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return std::find(list.begin(), list.end(), target) != list.end();
+        }
+
+        bool insert_after(int target, int num)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            linear_linked_list<int>::iterator pos = std::find(list.begin(), list.end(), target);
+            if (pos == list.end())
+            {
+                return false;
+            }
+            list.emplace_after(pos, num);
+            return true;
+        }
+
+        bool erase_after(int target)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            linear_linked_list<int>::iterator pos = std::find(list.begin(), list.end(), target);
+            if (pos == list.end())
+            {
+                return false;
+            }
+            list.erase_after(pos);
+            return true;
+        }
+
+      private:
+
+        std::mutex mutex;
+        linear_linked_list<int> list;
+    };
+
+    // Fills the list, then runs threads doing operations in total with the
+    // given percentage of finds. Returns the number of finds that succeeded
+    template <class List>
+    int run_mix(List& list, int threads_count, int find_percent)
+    {
+        for (int i = 0; i < list_elements; ++i)
+        {
+            list.push_front(i);
+        }
+
+        std::mutex found_mutex;
+        int found = 0;
+        const int per_thread = operations / threads_count;
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threads_count; ++t)
+        {
+            threads.emplace_back([&, t]()
+            {
+                std::mt19937 gen(t);
+                std::uniform_int_distribution<int> element(0, list_elements - 1);
+                std::uniform_int_distribution<int> percent(0, 99);
+
+                int local = 0;
+                for (int i = 0; i < per_thread; ++i)
+                {
+                    const int target = element(gen);
+                    const int roll = percent(gen);
+
+                    if (roll < find_percent)
+                    {
+                        local += list.find(target);
+                    }
+                    else if (roll % 2 == 0)
+                    {
+                        list.insert_after(target, target);
+                    }
+                    else
+                    {
+                        list.erase_after(target);
+                    }
+                }
+
+                std::lock_guard<std::mutex> lock(found_mutex);
+                found += local;
+            });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        return found;
+    }
+}
+
+TEST_CASE("Shared list throughput by thread count and read/write mix", "[concurrent_linked_list]")
+{
+    for (int find_percent : { 90, 50, 10 })
+    {
+        for (int threads_count : { 1, 2, 4 })
+        {
+            const std::string suffix = std::to_string(threads_count) + " threads, "
+                                     + std::to_string(find_percent) + "% finds, 10^5 operations";
+
+            int locked_found = 0;
+            BENCHMARK("mutex guarded linear_linked_list, " + suffix)
+            {
+                locked_list list;
+                locked_found = run_mix(list, threads_count, find_percent);
+            }
+
+            int concurrent_found = 0;
+            BENCHMARK("concurrent_linked_list, " + suffix)
+            {
+                concurrent_linked_list<int> list;
+                concurrent_found = run_mix(list, threads_count, find_percent);
+            }
+
+            // Erased elements make some finds miss, but most targets remain
+            REQUIRE(locked_found > 0);
+            REQUIRE(concurrent_found > 0);
+        }
+    }
+}
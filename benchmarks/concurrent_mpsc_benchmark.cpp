@@ -0,0 +1,143 @@
+/*
+
+ File: concurrent_mpsc_benchmark.cpp
+
+ Brief: Compares the throughput of a concurrent_mpsc_list with a
+        linear_linked_list guarded by a std::mutex, used as a work queue.
+        1, 2 and 4 producer threads push 10^6 ints in total while a single
+        consumer pops them, the time until the consumer has popped the last
+        one is measured. The consumer of the locked list spins on the lock
+        the same way the concurrent list's consumer spins on an empty list.
+
+        NOTE: Contention only shows with the producers and the consumer on
+        separate cores. On a single core the threads take turns and the
+        results mostly measure the cost of each push and pop.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <catch.hpp>
+#include "linear_linked_list.hpp"
+#include "concurrent_mpsc_list.hpp"
+
+namespace
+{
+    const int queue_elements = 1000000;
+
+    // The work queue a concurrent_mpsc_list replaces
+    class locked_list
+    {
+      public:
+
+        void push_back(int num)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            list.push_back(num);
+        }
+
+        bool try_pop_front(int& out)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (list.empty())
+            {
+                return false;
+            }
+            list.pop_front(out);
+            return true;
+        }
+
+      private:
+
+        std::mutex mutex;
+        linear_linked_list<int> list;
+    };
+
+    // Runs producers pushing queue_elements in total against one consumer,
+    // returns the sum of the popped elements
+    template <class Queue>
+    long long run_queue(Queue& queue, int producers)
+    {
+        std::atomic<bool> start(false);
+        const int per_producer = queue_elements / producers;
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p)
+        {
+            threads.emplace_back([&queue, &start, per_producer]()
+            {
+                while (!start.load())
+                {
+                    std::this_thread::yield();
+                }
+                for (int i = 0; i < per_producer; ++i)
+                {
+                    queue.push_back(i);
+                }
+            });
+        }
+
+        start.store(true);
+
+        long long sum = 0;
+        int out = 0;
+        for (int received = 0; received < per_producer * producers; )
+        {
+            if (queue.try_pop_front(out))
+            {
+                sum += out;
+                ++received;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        return sum;
+    }
+}
+
+TEST_CASE("Work queue throughput with several producers", "[concurrent_mpsc]")
+{
+    for (int producers : { 1, 2, 4 })
+    {
+        const std::string suffix = std::to_string(producers) + " producers, 10^6 ints";
+        const int per_producer = queue_elements / producers;
+        const long long expected = static_cast<long long>(producers)
+                                 * per_producer * (per_producer - 1) / 2;
+
+        long long locked_sum = 0;
+        BENCHMARK("mutex guarded linear_linked_list, " + suffix)
+        {
+            locked_list queue;
+            locked_sum = run_queue(queue, producers);
+        }
+
+        long long concurrent_sum = 0;
+        BENCHMARK("concurrent_mpsc_list, " + suffix)
+        {
+            concurrent_mpsc_list<int> queue;
+            concurrent_sum = run_queue(queue, producers);
+        }
+
+        REQUIRE(locked_sum == expected);
+        REQUIRE(concurrent_sum == expected);
+    }
+}
@@ -0,0 +1,223 @@
+/*
+
+ File: concurrent_ordered_set_benchmark.cpp
+
+ Brief: Compares the throughput of a concurrent_ordered_set with a sorted
+        linear_linked_list guarded by a std::mutex, used to deduplicate
+        ints. Keys are drawn from 0 to 2000, and a set of about 1000
+        keys is searched, inserted into and erased from by 1, 2 and 4
+        threads doing 10^5 operations in total. Three mixes are measured:
+        90% lookups, 50% lookups and 10% lookups, the rest split evenly
+        between inserts and erases.
+
+        NOTE: Contention only shows with the threads on separate cores. On a
+        single core the threads take turns and the results mostly measure
+        the cost of each operation.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <catch.hpp>
+#include "linear_linked_list.hpp"
+#include "concurrent_ordered_set.hpp"
+
+namespace
+{
+    const int key_range = 2000;
+    const int operations = 100000;
+
+    // The sorted list under a lock that a concurrent_ordered_set replaces
+    class locked_sorted_list
+    {
+      public:
+
+        bool insert(int num)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (list.empty() || num < list.front())
+            {
+                list.push_front(num);
+                return true;
+            }
+
+            // Stops at the last element not greater than num
+            linear_linked_list<int>::iterator prev = list.begin();
+            for (linear_linked_list<int>::iterator it = prev; it != list.end() && *it <= num; ++it)
+            {
+                prev = it;
+            }
+            if (*prev == num)
+            {
+                return false;
+            }
+            list.emplace_after(prev, num);
+            return true;
+        }
+
+        bool erase(int num)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (list.empty() || num < list.front())
+            {
+                return false;
+            }
+            if (list.front() == num)
+            {
+                list.pop_front();
+                return true;
+            }
+
+            linear_linked_list<int>::iterator prev = list.begin();
+            for (linear_linked_list<int>::iterator it = prev; it != list.end() && *it < num; ++it)
+            {
+                prev = it;
+            }
+            linear_linked_list<int>::iterator next = prev;
+            if (++next == list.end() || *next != num)
+            {
+                return false;
+            }
+            list.erase_after(prev);
+            return true;
+        }
+
+        bool contains(int num)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (int element : list)
+            {
+                if (element >= num)
+                {
+                    return element == num;
+                }
+            }
+            return false;
+        }
+
+      private:
+
+        std::mutex mutex;
+        linear_linked_list<int> list;
+    };
+
+    // Fills the set with every other key, then runs threads doing operations
+    // in total with the given percentage of lookups. Returns the number of
+    // lookups that found their key
+    template <class Set>
+    int run_mix(Set& set, int threads_count, int lookup_percent)
+    {
+        for (int key = 0; key < key_range; key += 2)
+        {
+            set.insert(key);
+        }
+
+        std::mutex found_mutex;
+        int found = 0;
+        const int per_thread = operations / threads_count;
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threads_count; ++t)
+        {
+            threads.emplace_back([&, t]()
+            {
+                std::mt19937 gen(t);
+                std::uniform_int_distribution<int> key(0, key_range - 1);
+                std::uniform_int_distribution<int> percent(0, 99);
+
+                int local = 0;
+                for (int i = 0; i < per_thread; ++i)
+                {
+                    const int target = key(gen);
+                    const int roll = percent(gen);
+
+                    if (roll < lookup_percent)
+                    {
+                        local += set.contains(target);
+                    }
+                    else if (roll % 2 == 0)
+                    {
+                        set.insert(target);
+                    }
+                    else
+                    {
+                        set.erase(target);
+                    }
+                }
+
+                std::lock_guard<std::mutex> lock(found_mutex);
+                found += local;
+            });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        return found;
+    }
+}
+
+TEST_CASE("Sorted set throughput by thread count and read/write mix", "[concurrent_ordered_set]")
+{
+    for (int lookup_percent : { 90, 50, 10 })
+    {
+        for (int threads_count : { 1, 2, 4 })
+        {
+            const std::string suffix = std::to_string(threads_count) + " threads, "
+                                     + std::to_string(lookup_percent) + "% lookups, 10^5 operations";
+
+            int locked_found = 0;
+            BENCHMARK("mutex guarded sorted linear_linked_list, " + suffix)
+            {
+                locked_sorted_list set;
+                locked_found = run_mix(set, threads_count, lookup_percent);
+            }
+
+            int concurrent_found = 0;
+            BENCHMARK("concurrent_ordered_set, " + suffix)
+            {
+                concurrent_ordered_set<int> set;
+                concurrent_found = run_mix(set, threads_count, lookup_percent);
+            }
+
+            REQUIRE(locked_found > 0);
+            REQUIRE(concurrent_found > 0);
+        }
+    }
+}
+
+TEST_CASE("Both sorted sets agree from one thread", "[concurrent_ordered_set]")
+{
+    locked_sorted_list locked;
+    concurrent_ordered_set<int> concurrent;
+
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> key(0, 99);
+
+    bool agreed = true;
+    for (int i = 0; i < 10000; ++i)
+    {
+        const int target = key(gen);
+        switch (i % 3)
+        {
+            case 0: agreed = agreed && locked.insert(target) == concurrent.insert(target); break;
+            case 1: agreed = agreed && locked.erase(target) == concurrent.erase(target); break;
+            default: agreed = agreed && locked.contains(target) == concurrent.contains(target);
+        }
+    }
+
+    REQUIRE(agreed);
+}
@@ -0,0 +1,179 @@
+/*
+
+ File: concurrent_stack_benchmark.cpp
+
+ Brief: Compares the throughput of a concurrent_stack with a
+        linear_linked_list guarded by a std::mutex, used as a shared stack.
+        1, 2 and 4 threads each push and pop their share of 10^6 ints, popping
+        after every second push, the time until every thread finishes is
+        measured. Taking the elements with pop_all is compared with popping
+        them one at a time.
+
+        NOTE: Contention only shows with the threads on separate cores. On a
+        single core the threads take turns and the results mostly measure
+        the cost of each push and pop.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <catch.hpp>
+#include "linear_linked_list.hpp"
+#include "concurrent_stack.hpp"
+
+namespace
+{
+    const int stack_elements = 1000000;
+
+    // The shared stack a concurrent_stack replaces
+    class locked_stack
+    {
+      public:
+
+        void push_front(int num)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            list.push_front(num);
+        }
+
+        bool try_pop_front(int& out)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (list.empty())
+            {
+                return false;
+            }
+            list.pop_front(out);
+            return true;
+        }
+
+      private:
+
+        std::mutex mutex;
+        linear_linked_list<int> list;
+    };
+
+    // Runs threads that push and pop stack_elements in total, returns the sum
+    // of the popped elements
+    template <class Stack>
+    long long run_stack(Stack& stack, int threads_count)
+    {
+        std::atomic<bool> start(false);
+        std::atomic<long long> sum(0);
+        const int per_thread = stack_elements / threads_count;
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threads_count; ++t)
+        {
+            threads.emplace_back([&stack, &start, &sum, per_thread]()
+            {
+                while (!start.load())
+                {
+                    std::this_thread::yield();
+                }
+
+                long long local = 0;
+                int out = 0;
+                for (int i = 0; i < per_thread; ++i)
+                {
+                    stack.push_front(i);
+                    if (i % 2 == 1)
+                    {
+                        // Another thread may have popped ours, the stack is
+                        // never short of two elements for long
+                        for (int popped = 0; popped < 2; )
+                        {
+                            if (stack.try_pop_front(out))
+                            {
+                                local += out;
+                                ++popped;
+                            }
+                        }
+                    }
+                }
+                sum += local;
+            });
+        }
+
+        start.store(true);
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        return sum.load();
+    }
+}
+
+TEST_CASE("Shared stack throughput with several threads", "[concurrent_stack]")
+{
+    for (int threads_count : { 1, 2, 4 })
+    {
+        const std::string suffix = std::to_string(threads_count) + " threads, 10^6 ints";
+        const int per_thread = stack_elements / threads_count;
+        const long long expected = static_cast<long long>(threads_count)
+                                 * per_thread * (per_thread - 1) / 2;
+
+        long long locked_sum = 0;
+        BENCHMARK("mutex guarded linear_linked_list, " + suffix)
+        {
+            locked_stack stack;
+            locked_sum = run_stack(stack, threads_count);
+        }
+
+        long long concurrent_sum = 0;
+        BENCHMARK("concurrent_stack, " + suffix)
+        {
+            concurrent_stack<int> stack;
+            concurrent_sum = run_stack(stack, threads_count);
+        }
+
+        REQUIRE(locked_sum == expected);
+        REQUIRE(concurrent_sum == expected);
+    }
+}
+
+TEST_CASE("Taking every element of a concurrent_stack", "[concurrent_stack]")
+{
+    concurrent_stack<int> stack;
+    long long popped_sum = 0;
+    long long taken_sum = 0;
+
+    for (int i = 0; i < stack_elements; ++i)
+    {
+        stack.push_front(i);
+    }
+    BENCHMARK("try_pop_front, 10^6 ints")
+    {
+        int out = 0;
+        while (stack.try_pop_front(out))
+        {
+            popped_sum += out;
+        }
+    }
+
+    for (int i = 0; i < stack_elements; ++i)
+    {
+        stack.push_front(i);
+    }
+    BENCHMARK("pop_all, 10^6 ints")
+    {
+        linear_linked_list<int> list = stack.pop_all();
+        taken_sum = list.accumulate(0LL, [](long long sum, int num) { return sum + num; });
+    }
+
+    const long long expected = static_cast<long long>(stack_elements) * (stack_elements - 1) / 2;
+    REQUIRE(popped_sum == expected);
+    REQUIRE(taken_sum == expected);
+}
@@ -0,0 +1,209 @@
+/*
+
+ File: copy_benchmark.cpp
+
+ Brief: Compares copying a list with one push_back per element against the
+        copy constructor, which acquires nodes in batches before copying
+        elements into them, for 10^7 ints and 10^6 strings. Reports the share of nodes
+        whose successor starts within 64 bytes after them, and times a
+        traversal of each copy. In the C++17 configurations the ints are 
+        also copied into a std::pmr::monotonic_buffer_resource, where the 
+        copy constructor allocates its nodes in one block.
+        [copy_assignment] assigns a 10^6 element list over another, 
+        comparing copy-and-swap with the copy assignment operator, which 
+        overwrites the existing elements in place, and reports the 
+        allocator calls each makes.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <string>
+#include <cstdint>
+#include <catch.hpp>
+#include "counting_allocator.hpp"
+#include "linear_linked_list.hpp"
+
+namespace
+{
+    // Percentage of elements whose successor starts within 64 bytes after them
+    template <class List>
+    int adjacency(const List& list)
+    {
+        std::size_t adjacent = 0;
+        std::uintptr_t prev = 0;
+
+        for (const auto& element : list)
+        {
+            std::uintptr_t address = reinterpret_cast<std::uintptr_t>(&element);
+            adjacent += (address > prev && address - prev <= 64);
+            prev = address;
+        }
+
+        return static_cast<int>(adjacent * 100 / list.size());
+    }
+
+    template <class List>
+    void compare_copies(const List& origin, const std::string& name)
+    {
+        List pushed;
+        BENCHMARK("push_back copy of " + name)
+        {
+            for (const auto& element : origin)
+            {
+                pushed.push_back(element);
+            }
+        }
+
+        List* copied = nullptr;
+        BENCHMARK("copy construction of " + name)
+        {
+            copied = new List(origin);
+        }
+        REQUIRE(*copied == pushed);
+
+        std::size_t length = 0;
+        BENCHMARK("traversing the push_back copy of " + name)
+        {
+            for (const auto& element : pushed)
+            {
+                length += element.size();
+            }
+        }
+        BENCHMARK("traversing the copy constructed " + name)
+        {
+            for (const auto& element : *copied)
+            {
+                length -= element.size();
+            }
+        }
+        REQUIRE(length == 0);
+
+        WARN(name << ": " << adjacency(pushed) << "% adjacent after push_back, "
+             << adjacency(*copied) << "% after copy construction");
+
+        delete copied;
+    }
+}
+
+TEST_CASE("Copying 10^7 ints", "[copy]")
+{
+    linear_linked_list<int> origin;
+    for (int i = 0; i < 10000000; ++i)
+    {
+        origin.push_back(i);
+    }
+
+    linear_linked_list<int> pushed;
+    BENCHMARK("push_back copy of 10^7 ints")
+    {
+        for (int num : origin)
+        {
+            pushed.push_back(num);
+        }
+    }
+
+    linear_linked_list<int>* copied = nullptr;
+    BENCHMARK("copy construction of 10^7 ints")
+    {
+        copied = new linear_linked_list<int>(origin);
+    }
+    REQUIRE(*copied == pushed);
+
+    WARN("ints: " << adjacency(pushed) << "% adjacent after push_back, "
+         << adjacency(*copied) << "% after copy construction");
+
+    delete copied;
+}
+
+TEST_CASE("Copying 10^6 strings", "[copy]")
+{
+    linear_linked_list<std::string> origin;
+    for (int i = 0; i < 1000000; ++i)
+    {
+        origin.push_back("a string too long for small string storage " + std::to_string(i));
+    }
+
+    compare_copies(origin, "10^6 strings");
+}
+
+TEST_CASE("Copy assigning a 10^6 element list over another", "[copy_assignment]")
+{
+    typedef linear_linked_list<std::string, counting_allocator<std::string>> counted_list;
+
+    counted_list origin;
+    counted_list swapped;
+    counted_list assigned;
+    for (int i = 0; i < 1000000; ++i)
+    {
+        origin.push_back("origin " + std::to_string(i));
+        swapped.push_back("old " + std::to_string(i));
+        assigned.push_back("old " + std::to_string(i));
+    }
+
+    allocation_counter::reset();
+    BENCHMARK("copy-and-swap, 10^6 strings over 10^6 strings")
+    {
+        counted_list copy(origin);
+        swapped.swap(copy);
+    }
+    std::size_t swap_calls = allocation_counter::instance().allocations 
+                           + allocation_counter::instance().deallocations;
+
+    allocation_counter::reset();
+    BENCHMARK("copy assignment, 10^6 strings over 10^6 strings")
+    {
+        assigned = origin;
+    }
+    std::size_t assign_calls = allocation_counter::instance().allocations 
+                             + allocation_counter::instance().deallocations;
+
+    REQUIRE(swapped == origin);
+    REQUIRE(assigned == origin);
+
+    WARN("copy-and-swap made " << swap_calls << " node allocator calls, "
+         << "copy assignment made " << assign_calls);
+}
+
+#ifdef LINKED_LIST_HAS_PMR
+
+TEST_CASE("Copying 10^7 ints into a monotonic resource", "[copy]")
+{
+    std::pmr::monotonic_buffer_resource arena;
+    pmr::linear_linked_list<int> origin(&arena);
+    for (int i = 0; i < 10000000; ++i)
+    {
+        origin.push_back(i);
+    }
+
+    std::pmr::monotonic_buffer_resource pushed_arena;
+    pmr::linear_linked_list<int> pushed(&pushed_arena);
+    BENCHMARK("push_back copy of 10^7 ints, monotonic_buffer_resource")
+    {
+        for (int num : origin)
+        {
+            pushed.push_back(num);
+        }
+    }
+
+    std::pmr::monotonic_buffer_resource copied_arena;
+    pmr::linear_linked_list<int>* copied = nullptr;
+    BENCHMARK("copy construction of 10^7 ints, monotonic_buffer_resource")
+    {
+        copied = new pmr::linear_linked_list<int>(origin, &copied_arena);
+    }
+    REQUIRE(*copied == pushed);
+
+    WARN("ints in an arena: " << adjacency(pushed) << "% adjacent after push_back, "
+         << adjacency(*copied) << "% after copy construction");
+
+    delete copied;
+}
+
+#endif // LINKED_LIST_HAS_PMR
@@ -0,0 +1,72 @@
+/*
+ 
+ File: counting_allocator.hpp
+
+ Brief: Stateless allocator that counts every call made to the global heap. 
+        Used by the benchmarks to report how many allocations an operation 
+        costs alongside how long it takes.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef COUNTING_ALLOCATOR_H
+#define COUNTING_ALLOCATOR_H
+
+#include <new> // ::operator new, ::operator delete
+#include <cstddef> // std::size_t
+
+struct allocation_counter
+{
+    std::size_t allocations;
+    std::size_t deallocations;
+
+    // Shared by every counting_allocator regardless of value_type
+    static allocation_counter& instance()
+    {
+        static allocation_counter counter = { 0, 0 };
+        return counter;
+    }
+
+    static void reset()
+    {
+        instance().allocations = instance().deallocations = 0;
+    }
+};
+
+template <typename T>
+struct counting_allocator
+{
+    typedef T value_type;
+
+    counting_allocator() {}
+
+    template <typename U>
+    counting_allocator(const counting_allocator<U>&) {}
+
+    T* allocate(std::size_t n)
+    {
+        ++allocation_counter::instance().allocations;
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t)
+    {
+        ++allocation_counter::instance().deallocations;
+        ::operator delete(ptr);
+    }
+
+    template <typename U>
+    bool operator==(const counting_allocator<U>&) const { return true; }
+
+    template <typename U>
+    bool operator!=(const counting_allocator<U>&) const { return false; }
+};
+
+#endif // COUNTING_ALLOCATOR_H
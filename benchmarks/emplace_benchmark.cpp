@@ -0,0 +1,91 @@
+/*
+ 
+ File: emplace_benchmark.cpp
+
+ Brief: Compares building a list of heavy records with push_back, which 
+        moves a temporary into each node, against emplace_back, which 
+        constructs each record in its node. Reports the temporaries avoided.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <string>
+#include <cstring>
+#include <catch.hpp>
+#include "linear_linked_list.hpp"
+
+namespace
+{
+    // A record with a heap allocated name and an inline buffer
+    struct record
+    {
+        record(int id, const char* name)
+            : id(id), name(name)
+        {
+            std::memset(buffer, id & 0xFF, sizeof(buffer));
+        }
+
+        record(const record& origin)
+            : id(origin.id), name(origin.name)
+        {
+            ++temporaries;
+            std::memcpy(buffer, origin.buffer, sizeof(buffer));
+        }
+
+        record(record&& origin)
+            : id(origin.id), name(std::move(origin.name))
+        {
+            ++temporaries;
+            std::memcpy(buffer, origin.buffer, sizeof(buffer));
+        }
+
+        int id;
+        std::string name;
+        char buffer[64];
+
+        static std::size_t temporaries;
+    };
+    std::size_t record::temporaries = 0;
+
+    const int records = 1000000;
+    const char* const name = "a record name too long for small string storage";
+}
+
+TEST_CASE("Building a list of 10^6 records", "[emplace]")
+{
+    std::size_t pushed_temporaries = 0;
+    std::size_t emplaced_temporaries = 0;
+
+    record::temporaries = 0;
+    BENCHMARK("10^6 push_back(record(...))")
+    {
+        linear_linked_list<record> list;
+        for (int i = 0; i < records; ++i)
+        {
+            list.push_back(record(i, name));
+        }
+    }
+    pushed_temporaries = record::temporaries;
+
+    record::temporaries = 0;
+    BENCHMARK("10^6 emplace_back(...)")
+    {
+        linear_linked_list<record> list;
+        for (int i = 0; i < records; ++i)
+        {
+            list.emplace_back(i, name);
+        }
+    }
+    emplaced_temporaries = record::temporaries;
+
+    WARN("push_back moved " << pushed_temporaries << " temporaries, "
+         << "emplace_back moved " << emplaced_temporaries);
+    REQUIRE(emplaced_temporaries < pushed_temporaries);
+}
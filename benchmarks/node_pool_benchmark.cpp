@@ -0,0 +1,120 @@
+/*
+ 
+ File: node_pool_benchmark.cpp
+
+ Brief: Measures the queue workload of alternating push_back and pop_front 
+        with and without the node pool, and many short-lived lists with and 
+        without the thread cache. Reports the allocator calls each avoids.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <catch.hpp>
+#include "counting_allocator.hpp"
+#include "linear_linked_list.hpp"
+
+namespace
+{
+    typedef linear_linked_list<int, counting_allocator<int>> counted_list;
+
+    const int operations = 1000000;
+    const int queue_depth = 64;
+
+    // Keeps queue_depth elements in flight, then pushes and pops in turn
+    void run_queue(counted_list& queue)
+    {
+        for (int i = 0; i < queue_depth; ++i)
+        {
+            queue.push_back(i);
+        }
+        for (int i = 0; i < operations; ++i)
+        {
+            queue.push_back(i).pop_front();
+        }
+        queue.clear();
+    }
+
+    const int short_lived_lists = 10000;
+    const int short_lived_length = 100;
+
+    // Builds and destroys many small lists, as a request handler would
+    void run_short_lived_lists()
+    {
+        for (int i = 0; i < short_lived_lists; ++i)
+        {
+            counted_list list;
+            for (int j = 0; j < short_lived_length; ++j)
+            {
+                list.push_back(j);
+            }
+        }
+    }
+}
+
+TEST_CASE("Alternating push_back and pop_front with the node pool", "[pool]")
+{
+    std::size_t plain_allocations = 0;
+    std::size_t pooled_allocations = 0;
+
+    allocation_counter::reset();
+    BENCHMARK("10^6 push_back/pop_front pairs, no pool")
+    {
+        counted_list queue;
+        run_queue(queue);
+    }
+    plain_allocations = allocation_counter::instance().allocations;
+
+    allocation_counter::reset();
+    BENCHMARK("10^6 push_back/pop_front pairs, pooled")
+    {
+        counted_list queue;
+        queue.reserve(queue_depth);
+        run_queue(queue);
+    }
+    pooled_allocations = allocation_counter::instance().allocations;
+
+    WARN("allocations without a pool: " << plain_allocations << '\n'
+      << "allocations with a pool:    " << pooled_allocations << '\n'
+      << "allocations avoided:        " << plain_allocations - pooled_allocations);
+
+    REQUIRE(pooled_allocations < plain_allocations);
+    REQUIRE(allocation_counter::instance().allocations 
+            == allocation_counter::instance().deallocations);
+}
+
+TEST_CASE("Building many short-lived lists with the thread cache", "[thread_cache]")
+{
+    std::size_t plain_allocations = 0;
+    std::size_t cached_allocations = 0;
+
+    allocation_counter::reset();
+    BENCHMARK("10^4 lists of 100 elements, no cache")
+    {
+        run_short_lived_lists();
+    }
+    plain_allocations = allocation_counter::instance().allocations;
+
+    allocation_counter::reset();
+    BENCHMARK("10^4 lists of 100 elements, thread cache")
+    {
+        counted_list::reserve_thread_cache(short_lived_length);
+        run_short_lived_lists();
+        counted_list::release_thread_cache();
+    }
+    cached_allocations = allocation_counter::instance().allocations;
+
+    WARN("allocations without a cache: " << plain_allocations << '\n'
+      << "allocations with a cache:    " << cached_allocations << '\n'
+      << "allocations avoided:         " << plain_allocations - cached_allocations);
+
+    REQUIRE(cached_allocations < plain_allocations);
+    REQUIRE(allocation_counter::instance().allocations 
+            == allocation_counter::instance().deallocations);
+}
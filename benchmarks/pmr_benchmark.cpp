@@ -0,0 +1,74 @@
+/*
+ 
+ File: pmr_benchmark.cpp
+
+ Brief: Compares tearing down a 10^6 node list allocated from the global heap
+        with one allocated from a std::pmr::monotonic_buffer_resource arena.
+        Only built into the C++17 configurations.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <memory>
+#include <string>
+#include <catch.hpp>
+#include "linear_linked_list.hpp"
+
+#ifdef LINKED_LIST_HAS_PMR
+
+namespace
+{
+    const int length = 1000000;
+
+    template <class List>
+    void fill(List& list)
+    {
+        for (int i = 0; i < length; ++i)
+        {
+            list.push_back(i);
+        }
+    }
+}
+
+TEST_CASE("Tearing down a 10^6 node list", "[pmr]")
+{
+    std::unique_ptr<linear_linked_list<int>> heap_list(new linear_linked_list<int>);
+    fill(*heap_list);
+
+    BENCHMARK("destroy, std::allocator")
+    {
+        heap_list.reset();
+    }
+
+    std::pmr::monotonic_buffer_resource arena;
+    std::unique_ptr<pmr::linear_linked_list<int>> arena_list(
+        new pmr::linear_linked_list<int>(&arena));
+    fill(*arena_list);
+
+    BENCHMARK("destroy, monotonic_buffer_resource")
+    {
+        arena_list.reset();
+    }
+
+    std::pmr::monotonic_buffer_resource string_arena;
+    pmr::linear_linked_list<std::string> strings(&string_arena);
+    for (int i = 0; i < length; ++i)
+    {
+        strings.push_back("short string");
+    }
+
+    BENCHMARK("clear std::string elements, monotonic_buffer_resource")
+    {
+        strings.clear();
+    }
+    REQUIRE(strings.empty());
+}
+
+#endif // LINKED_LIST_HAS_PMR
@@ -0,0 +1,146 @@
+/*
+
+ File: prefetch_benchmark.cpp
+
+ Brief: Measures prefetching on 4 * 10^6 element lists whose nodes are
+        scattered across the heap, which is what a long lived list looks
+        like after many inserts and erases. The nodes are scattered by
+        sorting a list on random keys, which relinks them in random order.
+
+        [prefetch] sums the elements with accumulate at prefetch distances
+        0 to 32, and runs for_each with some work per element, where the
+        prefetches have more time to complete. [prefetch_operations] times
+        operator==, copy construction, remove_if and merge, which prefetch
+        LINKED_LIST_PREFETCH_DISTANCE nodes ahead. Build once without it
+        and once with e.g. -DLINKED_LIST_PREFETCH_DISTANCE=8 to compare.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <random>
+#include <string>
+#include <cstdint>
+#include <catch.hpp>
+#include "linear_linked_list.hpp"
+
+namespace
+{
+    const int scattered_length = 4000000;
+
+    // A list of 0, 1, 2, ... whose consecutive nodes lie far apart in memory
+    linear_linked_list<int> scattered_list(int length = scattered_length)
+    {
+        linear_linked_list<int> list;
+        for (int i = 0; i < length; ++i)
+        {
+            list.push_back(i);
+        }
+
+        // Sorting on random keys relinks the nodes in random order
+        std::mt19937 engine(2018);
+        list.sort_by([&engine](int){ return engine(); });
+
+        // Renumber the elements so that they count up again
+        int next = 0;
+        list.for_each([&next](int& num){ num = next++; });
+
+        return list;
+    }
+
+    // A few dependent multiplications, standing in for work on each element
+    std::uint32_t mix(std::uint32_t hash, int num)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            hash = (hash ^ static_cast<std::uint32_t>(num)) * 16777619u;
+        }
+        return hash;
+    }
+}
+
+TEST_CASE("Traversing scattered nodes with prefetching", "[prefetch]")
+{
+    const linear_linked_list<int> list = scattered_list();
+    const long long expected = static_cast<long long>(scattered_length)
+                             * (scattered_length - 1) / 2;
+
+    long long sum = 0;
+    BENCHMARK("range-for sum of 4*10^6 scattered ints")
+    {
+        sum = 0;
+        for (int num : list)
+        {
+            sum += num;
+        }
+    }
+    REQUIRE(sum == expected);
+
+    const std::size_t distances[] = { 0, 1, 2, 4, 8, 16, 32 };
+    for (std::size_t distance : distances)
+    {
+        BENCHMARK("accumulate 4*10^6 scattered ints, distance " + std::to_string(distance))
+        {
+            sum = list.accumulate(0ll, [](long long total, int num){ return total + num; },
+                                  distance);
+        }
+        REQUIRE(sum == expected);
+    }
+
+    std::uint32_t hashes[2] = { 0, 0 };
+    for (std::size_t distance : { std::size_t(0), std::size_t(8) })
+    {
+        std::uint32_t& hash = hashes[distance == 0 ? 0 : 1];
+        BENCHMARK("for_each hashing 4*10^6 scattered ints, distance "
+                  + std::to_string(distance))
+        {
+            list.for_each([&hash](int num){ hash = mix(hash, num); }, distance);
+        }
+    }
+    REQUIRE(hashes[0] == hashes[1]);
+}
+
+TEST_CASE("Operations on scattered nodes", "[prefetch_operations]")
+{
+    const std::string distance = ", prefetch distance "
+        + std::to_string(linear_linked_list<int>::prefetch_distance);
+
+    linear_linked_list<int> list = scattered_list();
+    linear_linked_list<int> same = scattered_list();
+
+    bool equal = false;
+    BENCHMARK("operator== on 4*10^6 scattered ints" + distance)
+    {
+        equal = (list == same);
+    }
+    REQUIRE(equal);
+
+    linear_linked_list<int>* copy = nullptr;
+    BENCHMARK("copy construction of 4*10^6 scattered ints" + distance)
+    {
+        copy = new linear_linked_list<int>(list);
+    }
+    REQUIRE(*copy == list);
+    delete copy;
+
+    BENCHMARK("remove_if on 4*10^6 scattered ints" + distance)
+    {
+        list.remove_if([](int num){ return num % 4 == 0; });
+    }
+    REQUIRE(list.size() == scattered_length / 4 * 3);
+
+    linear_linked_list<int> odds = scattered_list(scattered_length / 2);
+    odds.remove_if([](int num){ return num % 2 == 0; });
+    same.remove_if([](int num){ return num % 2 != 0; });
+    BENCHMARK("merge of 2*10^6 into 2*10^6 scattered ints" + distance)
+    {
+        same.merge(odds);
+    }
+    REQUIRE(same.size() == scattered_length / 2 + scattered_length / 4);
+}
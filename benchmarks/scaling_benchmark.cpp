@@ -0,0 +1,112 @@
+/*
+ 
+ File: scaling_benchmark.cpp
+
+ Brief: Runs each linear_linked_list operation on 10^7 node lists. Verifies
+        every operation completes without exhausting the stack and reports 
+        how long each one takes.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <memory>
+#include <random>
+#include <catch.hpp>
+#include "linear_linked_list.hpp"
+
+namespace
+{
+    const std::size_t length = 10000000;
+
+    linear_linked_list<int> random_list(std::size_t size, unsigned seed)
+    {
+        std::mt19937 engine(seed);
+        linear_linked_list<int> list;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            list.push_back(static_cast<int>(engine()));
+        }
+        return list;
+    }
+}
+
+TEST_CASE("Scaling linear_linked_list operations to 10^7 nodes", "[scaling]")
+{
+    linear_linked_list<int> list;
+
+    BENCHMARK("push_back 10^7 elements")
+    {
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            list.push_back(static_cast<int>(i));
+        }
+    }
+    REQUIRE(list.size() >= length);
+
+    std::size_t size = 0;
+    BENCHMARK("size")
+    {
+        size = list.size();
+    }
+    REQUIRE(size == list.size());
+
+    linear_linked_list<int>::iterator middle;
+    BENCHMARK("middle")
+    {
+        middle = list.middle();
+    }
+    REQUIRE(middle != list.end());
+
+    BENCHMARK("reverse")
+    {
+        list.reverse();
+    }
+    REQUIRE_FALSE(list.empty());
+
+    int removed = 0;
+    BENCHMARK("remove_if half of the elements")
+    {
+        removed += list.remove_if([](int n){ return n % 2 == 0; });
+    }
+    REQUIRE(removed > 0);
+
+    BENCHMARK("clear")
+    {
+        list.clear();
+    }
+    REQUIRE(list.empty());
+
+    std::unique_ptr<linear_linked_list<int>> doomed(
+        new linear_linked_list<int>(random_list(length, 1)));
+
+    BENCHMARK("destruction")
+    {
+        doomed.reset();
+    }
+}
+
+TEST_CASE("Scaling sort and merge to 10^7 nodes", "[scaling]")
+{
+    linear_linked_list<int> list = random_list(length, 2);
+    linear_linked_list<int> other = random_list(length, 3);
+
+    BENCHMARK("sort 10^7 random elements")
+    {
+        list.sort();
+    }
+    other.sort();
+
+    BENCHMARK("merge two sorted 10^7 element lists")
+    {
+        list.merge(other);
+    }
+    REQUIRE(other.empty());
+    REQUIRE(list.front() <= list.back());
+}
@@ -0,0 +1,290 @@
+/*
+ 
+ File: sort_benchmark.cpp
+
+ Brief: [sort] sorts 10^6 element lists of random, sorted, reversed and
+        mostly sorted input with the automatic strategy. Mostly sorted input
+        resembles a time series with a few late arrivals. [sort_strategy]
+        compares the merge and gather strategies on random lists of 10^4, 
+        10^6 and 10^7 elements. [parallel_sort] sorts 10^7 random elements 
+        with parallel_sort on 1, 2, 4, ... up to every hardware thread.
+        [sort_by_key] compares both sort_by_key strategies with sort on 
+        random 32 bit keys and on timestamps that span only three bytes.
+        [stable_sort] compares sort and stable_sort on random elements. 
+        [sort_by] sorts 10^5 strings case insensitively, lowercasing in the
+        comparison and lowercasing once per element with sort_by.
+        
+        NOTE: Run each tag separately. Freeing millions of nodes leaves 
+        the heap fragmented, which slows the traversal of lists built 
+        afterwards, and the allocator's deferred bookkeeping is paid by the 
+        next large allocation, such as the gather strategy's pointer array.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <cctype>
+#include <random>
+#include <string>
+#include <thread>
+#include <catch.hpp>
+#include "linear_linked_list.hpp"
+
+namespace
+{
+    typedef linear_linked_list<int>::sort_strategy sort_strategy;
+
+    const int sort_length = 1000000;
+
+    enum class input { random, sorted, reversed, mostly_sorted };
+
+    linear_linked_list<int> sort_input(input kind, int length = sort_length)
+    {
+        std::mt19937 engine(2018);
+        std::uniform_int_distribution<int> percent(0, 99);
+        linear_linked_list<int> list;
+
+        for (int i = 0; i < length; ++i)
+        {
+            switch (kind)
+            {
+                case input::random: 
+                    list.push_back(static_cast<int>(engine())); 
+                    break;
+                case input::sorted: 
+                    list.push_back(i); 
+                    break;
+                case input::reversed: 
+                    list.push_back(sort_length - i); 
+                    break;
+                case input::mostly_sorted:
+                    // One element in a hundred arrives out of order
+                    list.push_back(percent(engine) == 0 ? i - percent(engine) * 100 : i);
+                    break;
+            }
+        }
+        return list;
+    }
+
+    bool is_sorted(const linear_linked_list<int>& list)
+    {
+        linear_linked_list<int>::const_iterator prev = list.begin();
+        for (linear_linked_list<int>::const_iterator it = prev; it != list.end(); prev = it++)
+        {
+            if (*it < *prev)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void compare_strategies(int length, const char* merge, const char* gather)
+    {
+        linear_linked_list<int> merged = sort_input(input::random, length);
+        linear_linked_list<int> gathered = merged;
+
+        BENCHMARK(merge)
+        {
+            merged.sort(sort_strategy::merge);
+        }
+        BENCHMARK(gather)
+        {
+            gathered.sort(sort_strategy::gather);
+        }
+
+        REQUIRE(is_sorted(merged));
+        REQUIRE(merged == gathered);
+    }
+}
+
+TEST_CASE("Sorting 10^6 element lists", "[sort]")
+{
+    linear_linked_list<int> random = sort_input(input::random);
+    linear_linked_list<int> sorted = sort_input(input::sorted);
+    linear_linked_list<int> reversed = sort_input(input::reversed);
+    linear_linked_list<int> mostly_sorted = sort_input(input::mostly_sorted);
+
+    BENCHMARK("sort random input")
+    {
+        random.sort();
+    }
+    BENCHMARK("sort sorted input")
+    {
+        sorted.sort();
+    }
+    BENCHMARK("sort reversed input")
+    {
+        reversed.sort();
+    }
+    BENCHMARK("sort mostly sorted input")
+    {
+        mostly_sorted.sort();
+    }
+
+    REQUIRE(is_sorted(random));
+    REQUIRE(is_sorted(sorted));
+    REQUIRE(is_sorted(reversed));
+    REQUIRE(is_sorted(mostly_sorted));
+}
+
+TEST_CASE("Merge and gather sort strategies on random input", "[sort_strategy]")
+{
+    compare_strategies(10000, "merge sort 10^4 random", "gather sort 10^4 random");
+    compare_strategies(1000000, "merge sort 10^6 random", "gather sort 10^6 random");
+    compare_strategies(10000000, "merge sort 10^7 random", "gather sort 10^7 random");
+}
+
+TEST_CASE("Scaling parallel_sort of 10^7 random elements", "[parallel_sort]")
+{
+    const linear_linked_list<int> random = sort_input(input::random, 10000000);
+
+    std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+
+    for (std::size_t threads = 1; ; threads = std::min(threads * 2, hardware))
+    {
+        linear_linked_list<int> list = random;
+
+        BENCHMARK("parallel_sort 10^7 random, " + std::to_string(threads) + " threads")
+        {
+            list.parallel_sort(threads);
+        }
+        REQUIRE(is_sorted(list));
+
+        if (threads == hardware)
+        {
+            break;
+        }
+    }
+}
+
+TEST_CASE("Radix sorting 10^6 elements by key", "[sort_by_key]")
+{
+    linear_linked_list<int> compared = sort_input(input::random);
+    linear_linked_list<int> radix = compared;
+
+    BENCHMARK("sort 10^6 random keys")
+    {
+        compared.sort();
+    }
+    linear_linked_list<int> relinked = radix;
+
+    BENCHMARK("sort_by_key 10^6 random keys")
+    {
+        radix.sort_by_key([](int num){ return num; });
+    }
+    REQUIRE(radix == compared);
+
+    BENCHMARK("sort_by_key 10^6 random keys, relinking buckets")
+    {
+        relinked.sort_by_key([](int num){ return num; }, sort_strategy::merge);
+    }
+    REQUIRE(relinked == compared);
+
+    // Seconds within a day after a fixed epoch, only the low three bytes vary
+    std::mt19937 engine(7);
+    std::uniform_int_distribution<long long> second(0, 86399);
+    linear_linked_list<long long> timestamps;
+    for (int i = 0; i < sort_length; ++i)
+    {
+        timestamps.push_back(1500000000ll + second(engine));
+    }
+    linear_linked_list<long long> radix_timestamps = timestamps;
+    linear_linked_list<long long> relinked_timestamps = timestamps;
+
+    BENCHMARK("sort 10^6 timestamps")
+    {
+        timestamps.sort();
+    }
+    BENCHMARK("sort_by_key 10^6 timestamps")
+    {
+        radix_timestamps.sort_by_key([](long long time){ return time; });
+    }
+    REQUIRE(radix_timestamps == timestamps);
+
+    BENCHMARK("sort_by_key 10^6 timestamps, relinking buckets")
+    {
+        relinked_timestamps.sort_by_key([](long long time){ return time; }, 
+            linear_linked_list<long long>::sort_strategy::merge);
+    }
+    REQUIRE(relinked_timestamps == timestamps);
+}
+
+TEST_CASE("Stable sorting 10^6 random elements", "[stable_sort]")
+{
+    linear_linked_list<int> sorted = sort_input(input::random);
+    linear_linked_list<int> stable = sorted;
+    linear_linked_list<int> stable_merged = sorted;
+
+    BENCHMARK("sort 10^6 random elements")
+    {
+        sorted.sort();
+    }
+    BENCHMARK("stable_sort 10^6 random elements")
+    {
+        stable.stable_sort();
+    }
+    BENCHMARK("stable_sort 10^6 random elements, merge strategy")
+    {
+        stable_merged.stable_sort(sort_strategy::merge);
+    }
+
+    REQUIRE(stable == sorted);
+    REQUIRE(stable_merged == sorted);
+}
+
+TEST_CASE("Sorting 10^5 strings by an expensive key", "[sort_by]")
+{
+    const int length = 100000;
+    int lowered = 0;
+
+    auto lowercase = [&lowered](const std::string& str)
+    {
+        ++lowered;
+        std::string key(str);
+        for (char& letter : key)
+        {
+            letter = static_cast<char>(std::tolower(static_cast<unsigned char>(letter)));
+        }
+        return key;
+    };
+
+    std::mt19937 engine(2018);
+    std::uniform_int_distribution<int> letter(0, 51);
+    linear_linked_list<std::string> compared;
+    for (int i = 0; i < length; ++i)
+    {
+        std::string word(24, ' ');
+        for (char& c : word)
+        {
+            int pick = letter(engine);
+            c = static_cast<char>(pick < 26 ? 'a' + pick : 'A' + pick - 26);
+        }
+        compared.push_back(word);
+    }
+    linear_linked_list<std::string> projected = compared;
+
+    BENCHMARK("sort 10^5 strings, lowercasing each comparison")
+    {
+        compared.stable_sort([&lowercase](const std::string& lhs, const std::string& rhs)
+        {
+            return lowercase(lhs) < lowercase(rhs);
+        });
+    }
+    WARN("lowercased " << lowered << " strings");
+    lowered = 0;
+
+    BENCHMARK("sort_by 10^5 strings, lowercasing each element once")
+    {
+        projected.sort_by(lowercase);
+    }
+    WARN("lowercased " << lowered << " strings");
+
+    REQUIRE(projected == compared);
+}
@@ -0,0 +1,94 @@
+/*
+ 
+ File: unrolled_linked_list_benchmark.cpp
+
+ Brief: Compares iteration, remove_if and sort throughput of the 
+        unrolled_linked_list against the linear_linked_list for small 
+        element types.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <random>
+#include <catch.hpp>
+#include "linear_linked_list.hpp"
+#include "unrolled_linked_list.hpp"
+
+namespace
+{
+    const int length = 1000000;
+
+    template <class List>
+    List random_list(unsigned seed)
+    {
+        std::mt19937 engine(seed);
+        List list;
+        for (int i = 0; i < length; ++i)
+        {
+            list.push_back(static_cast<typename List::value_type>(engine()));
+        }
+        return list;
+    }
+
+    template <class List>
+    void run_benchmarks(const char* iterate, const char* remove, const char* sort)
+    {
+        List list = random_list<List>(42);
+
+        long long sum = 0;
+        BENCHMARK(iterate)
+        {
+            for (auto value : list)
+            {
+                sum += value;
+            }
+        }
+        REQUIRE(sum != 0);
+
+        List sortable = list;
+        BENCHMARK(sort)
+        {
+            sortable.sort();
+        }
+
+        int removed = 0;
+        BENCHMARK(remove)
+        {
+            removed += list.remove_if([](typename List::value_type n){ return n % 2 == 0; });
+        }
+        REQUIRE(removed > 0);
+    }
+}
+
+TEST_CASE("Unrolled and linear lists of 10^6 ints", "[unrolled]")
+{
+    run_benchmarks<linear_linked_list<int>>(
+        "iterate, linear_linked_list<int>", 
+        "remove_if, linear_linked_list<int>", 
+        "sort, linear_linked_list<int>");
+
+    run_benchmarks<unrolled_linked_list<int>>(
+        "iterate, unrolled_linked_list<int>", 
+        "remove_if, unrolled_linked_list<int>", 
+        "sort, unrolled_linked_list<int>");
+}
+
+TEST_CASE("Unrolled and linear lists of 10^6 chars", "[unrolled]")
+{
+    run_benchmarks<linear_linked_list<char>>(
+        "iterate, linear_linked_list<char>", 
+        "remove_if, linear_linked_list<char>", 
+        "sort, linear_linked_list<char>");
+
+    run_benchmarks<unrolled_linked_list<char>>(
+        "iterate, unrolled_linked_list<char>", 
+        "remove_if, unrolled_linked_list<char>", 
+        "sort, unrolled_linked_list<char>");
+}
@@ -0,0 +1,336 @@
+/*
+
+ File: compact_linked_list.h
+
+ Brief: Compact Linked List is a singularly linked sequence container whose
+        nodes live in one contiguous, growable buffer and are linked by 32-bit
+        indices instead of pointers. Freed slots are kept on an index free
+        list for reuse. On 64-bit builds this halves the link overhead per
+        element and keeps nodes close together in memory. The interface
+        mirrors the linear_linked_list's push/pop, reverse, sort, merge, and
+        remove_if methods, as well as forward iterators.
+
+        NOTE: Like a vector, growing the buffer moves the elements, so any
+        insertion that grows the list invalidates iterators and references.
+        Use reserve() to insert without growing.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef COMPACT_LINKED_LIST_H
+#define COMPACT_LINKED_LIST_H
+
+#include <vector> // std::vector
+#include <memory> // std::allocator, std::allocator_traits
+#include <cstdint> // std::uint32_t
+#include <utility> // std::move, std::move_if_noexcept
+#include <algorithm> // std::swap, std::sort
+#include <stdexcept> // std::logic_error, std::length_error
+#include <type_traits> // std::aligned_storage
+#include <initializer_list>  // std::initializer_list
+
+template <typename T, class Allocator = std::allocator<T>>
+class compact_linked_list
+{
+  private:
+
+    struct Node;
+
+  public:
+
+    // forward declaration
+    class const_forward_iterator;
+    class forward_iterator;
+
+    /* Type definitions */
+    typedef T                      value_type;
+    typedef T*                     pointer;
+    typedef T&                     reference;
+    typedef const T&               const_reference;
+    typedef const T*               const_pointer;
+    typedef size_t                 size_type;
+    typedef std::uint32_t          index_type;
+    typedef Allocator              allocator_type;
+    typedef forward_iterator       iterator;
+    typedef const_forward_iterator const_iterator;
+    typedef compact_linked_list<T, Allocator>  self_type;
+
+    // Index that marks the end of a chain of slots
+    static const index_type npos = 0xFFFFFFFF;
+
+    /****** CONSTRUCTORS ******/
+
+    // Default
+    compact_linked_list();
+
+    // Empty list that allocates its buffer with the provided allocator
+    explicit compact_linked_list(const allocator_type& alloc);
+
+    // Ranged based
+    template <class InputIterator>
+    compact_linked_list(InputIterator begin, InputIterator end,
+                        const allocator_type& alloc = allocator_type());
+
+    // Initializer List
+    explicit compact_linked_list(std::initializer_list<value_type> init,
+                                 const allocator_type& alloc = allocator_type());
+
+    // Copy Constructor, the copy's nodes are laid out in list order
+    compact_linked_list(const self_type& origin);
+
+    // Move Constructor
+    compact_linked_list(self_type&& origin);
+
+    // Destructor
+    ~compact_linked_list();
+
+    /****** MODIFIERS ******/
+
+    // Adds an element to the front of the list
+    self_type& push_front(T&& data);
+    self_type& push_front(const_reference data);
+
+    // Adds an element to the back of the list
+    self_type& push_back(T&& data);
+    self_type& push_back(const_reference data);
+
+    // Removes the element at the front of the list
+    self_type& pop_front();
+
+    // Copies the front element onto the out_param and removes it
+    reference pop_front(reference out_param);
+
+    // Removes each element from the container, keeping the buffer
+    self_type& clear();
+
+    // Reverses the order of elements
+    self_type& reverse();
+
+    // Sorts the list, defaults to ascending order. Slot indices are gathered
+    // into a contiguous array, sorted, and relinked in one pass
+    self_type& sort();
+
+    template <class Compare>
+    self_type& sort(Compare&& comp);
+
+    // Merges list into this list. The lists have separate buffers, so list's
+    // elements are moved into this list's buffer before the indices are merged.
+    // If a move throws, the elements already moved are destroyed and their
+    // slots freed, both lists keep their other elements
+    self_type& merge(self_type& list);
+
+    template <class Compare>
+    self_type& merge(self_type& list, Compare&& comp);
+
+    iterator erase_after(iterator pos);
+
+    // Removes all items matching target, returns number of items removed
+    int remove(const_reference target);
+
+    // Removes the all items fullfilling the predicate function
+    template <class Predicate>
+    int remove_if(Predicate&& pred);
+
+    /****** CAPACITY ******/
+
+    // returns true if the list is empty
+    bool empty() const;
+
+    // returns the number of elements, the count is kept so this is O(1)
+    size_type size() const;
+
+    // returns the number of slots in the buffer
+    size_type capacity() const;
+
+    // Grows the buffer to hold at least n elements
+    self_type& reserve(size_type n);
+
+    // Shrinks the buffer to the size of the list. The elements are moved
+    // into the new buffer in list order, so traversal becomes sequential
+    self_type& shrink_to_fit();
+
+    /****** ELEMENT ACCESS ******/
+
+    // Returns a direct reference to the front element, throws if list is empty
+    reference front();
+    const_reference front() const;
+
+    // Returns a direct reference to the rear element, throws if list is empty
+    reference back();
+    const_reference back() const;
+
+    /****** ITERATORS ******/
+
+    iterator begin();
+    const_iterator begin() const;
+
+    iterator end();
+    const_iterator end() const;
+
+    /****** ALLOCATOR ******/
+
+    // Returns a copy of the allocator used to allocate the buffer
+    allocator_type get_allocator() const;
+
+    /****** COMPARISON OPERATORS ******/
+
+    // Compares sizes, then comapres each element of the list for equality
+    bool operator==(const self_type& rhs) const;
+
+    // returns the logical NOT of the equality comparison
+    bool operator!=(const self_type& rhs) const;
+
+    /****** COPY-ASSIGNMENT AND SWAP ******/
+
+    // Swaps buffers, effectively reassigning ownership. Allocators are
+    // swapped only if propagate_on_container_swap
+    void swap(self_type& origin);
+
+    // creates a copy of the origin, then swaps ownership with the copy. The
+    // origin's allocator is adopted if propagate_on_container_copy_assignment
+    self_type& operator=(const self_type& origin);
+
+    // Takes ownership of the origin's buffer
+    self_type& operator=(self_type&& origin);
+
+  private:
+
+    /*
+    @struct: Node
+
+    @brief: Node is one slot of the buffer. It stores the data, which is only
+            constructed while the slot is in use, and the index of the next
+            slot in the list, or in the free list for unused slots.
+    */
+    struct Node
+    {
+        pointer data() { return reinterpret_cast<pointer>(&storage); }
+
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+        index_type next;
+    };
+
+    typedef typename std::allocator_traits<Allocator>::template
+            rebind_alloc<Node>                  node_allocator;
+    typedef std::allocator_traits<node_allocator> node_traits;
+
+    Node* slots;
+
+    index_type head;
+    index_type tail;
+
+    // Chain of freed slots, linked through next
+    index_type free_list;
+
+    // Slots below used have been handed out at least once
+    index_type used;
+    index_type slot_count;
+
+    size_type count;
+
+    node_allocator alloc;
+
+    /* Subroutines */
+
+    // Takes a slot from the free list or the unused part of the buffer,
+    // growing the buffer if both are exhausted
+    index_type acquire_slot();
+
+    // Destroys the slot's data and adds the slot to the free list
+    void release_slot(index_type slot);
+
+    // Constructs data in a new slot, linking it to next
+    template <class... Args>
+    index_type create_slot(index_type next, Args&&... args);
+
+    // Constructs data in an acquired slot, returning the slot if construction throws
+    template <class... Args>
+    index_type construct_slot(index_type slot, index_type next, Args&&... args);
+
+    // Moves the elements into a buffer of new_capacity slots in list order
+    void relocate(size_type new_capacity);
+
+    // Swaps buffers and allocators regardless of the propagation traits
+    void swap_all(self_type& origin);
+
+    // Throws a logic error exception if the index is npos
+    void throw_if_null(index_type slot) const;
+
+  public:
+
+    /*
+    @class: const_forward_iterator
+
+    @brief: The const_forward_iterator is a read-only abstraction of a slot
+            index. This iterator type does not support decrementation or
+            random access
+    */
+    class const_forward_iterator
+    {
+      public:
+
+        typedef const_forward_iterator  self_type;
+
+        /* Constructors */
+
+        // default constructor points the iterator to the end
+        const_forward_iterator(Node* slots = nullptr, index_type index = npos)
+            : slots(slots), index(index) {}
+
+        /* Operator Overloads */
+
+        self_type& operator++(); // Prefix ++
+        self_type operator++(int); // Postfix ++
+
+        const_reference operator*() const;
+        const_pointer operator->() const;
+
+        // Iterators are equal if they point to the same slot
+        bool operator==(const self_type& rhs) const;
+        bool operator!=(const self_type& rhs) const;
+
+        friend compact_linked_list<T, Allocator>;
+
+      protected:
+
+        Node* slots;
+        index_type index;
+    };
+
+    /*
+    @class: forward_iterator
+
+    @brief: The forward_iterator is a read/write abstraction of a slot index.
+            The forward_iterator inherits all methods from the
+            const_forward_iterator but overrides the reference operators
+            to allow the client to mutate data
+    */
+    class forward_iterator : public const_forward_iterator
+    {
+      public:
+
+        /* Type definitions */
+        typedef forward_iterator    self_type;
+
+        forward_iterator(Node* slots = nullptr, index_type index = npos)
+            : const_forward_iterator(slots, index) {}
+
+        reference operator*();
+
+        pointer operator->();
+
+    };
+};
+
+#include "compact_linked_list.cpp"
+
+#endif //COMPACT_LINKED_LIST_H
+
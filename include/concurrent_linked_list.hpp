@@ -0,0 +1,183 @@
+/*
+
+ File: concurrent_linked_list.hpp
+
+ Brief: Concurrent Linked List is a singly linked list that any number of
+        threads may insert into, erase from and search at once. Every node
+        carries its own mutex and traversals lock hand over hand: the next
+        node is locked before the current one is released, so a thread
+        always holds the node whose link it reads or rewrites. Locks are
+        only ever taken from the front towards the back, which rules out
+        deadlock.
+
+        Threads block each other only on the nodes they pass at the same
+        time. Every operation starts at the front, so a thread heading for
+        the back follows the threads ahead of it, but it never waits for a
+        modification behind it or in a part of the list it has not reached.
+
+        NOTE: Elements are only reachable through the list's operations,
+        there are no iterators. Positions are given by value, and elements
+        are copied out rather than referenced, since a reference could
+        outlive the lock that protects it.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef CONCURRENT_LINKED_LIST_H
+#define CONCURRENT_LINKED_LIST_H
+
+#include <mutex> // std::mutex, std::unique_lock
+#include <atomic> // std::atomic
+#include <memory> // std::allocator, std::allocator_traits
+#include <utility> // std::move, std::forward
+
+template <typename T, class Allocator = std::allocator<T>>
+class concurrent_linked_list
+{
+  public:
+
+    /* Type definitions */
+    typedef T                      value_type;
+    typedef T&                     reference;
+    typedef const T&               const_reference;
+    typedef size_t                 size_type;
+    typedef Allocator              allocator_type;
+    typedef concurrent_linked_list<T, Allocator>    self_type;
+
+    /****** CONSTRUCTORS ******/
+
+    // Default constructor
+    concurrent_linked_list();
+
+    // Allocator constructor, nodes are allocated by a copy of alloc
+    explicit concurrent_linked_list(const allocator_type& alloc);
+
+    // Threads hold on to the list, so it is neither copied nor moved
+    concurrent_linked_list(const self_type& origin) = delete;
+    self_type& operator=(const self_type& origin) = delete;
+
+    // Destroys the elements, no thread may still be using the list
+    ~concurrent_linked_list();
+
+    /****** MODIFIERS ******/
+
+    // Adds an element to the front of the list. Locks the front only
+    self_type& push_front(const_reference data);
+    self_type& push_front(T&& data);
+
+    // Constructs an element in place at the front of the list
+    template <class... Args>
+    self_type& emplace_front(Args&&... args);
+
+    // Inserts data after the first element equal to target. Returns false,
+    // leaving the list unchanged, if there is no such element
+    bool insert_after(const_reference target, const_reference data);
+    bool insert_after(const_reference target, T&& data);
+
+    // Constructs an element in place after the first element equal to target
+    template <class... Args>
+    bool emplace_after(const_reference target, Args&&... args);
+
+    // Moves the front element into out_param and removes it, or returns
+    // false if the list is empty
+    bool try_pop_front(reference out_param);
+
+    // Removes the element after the first element equal to target. Returns
+    // false if there is no such element or it is the last one
+    bool erase_after(const_reference target);
+
+    // Removes all elements matching target, returns number of items removed
+    int remove(const_reference target);
+
+    // Removes the elements fulfilling the predicate, returns the number of
+    // elements removed. The predicate is called with the element's node
+    // and its predecessor locked, removed elements are destroyed after the
+    // traversal has released every lock
+    template <class Predicate>
+    int remove_if(Predicate&& pred);
+
+    /****** LOOKUP ******/
+
+    // Returns true if an element equal to target is in the list
+    bool find(const_reference target) const;
+
+    // Copies the first element fulfilling the predicate onto out_param, or
+    // returns false if there is none
+    template <class Predicate>
+    bool find_if(Predicate&& pred, reference out_param) const;
+
+    /****** CAPACITY ******/
+
+    // True if the list held no elements when it was checked, other threads
+    // may have changed that by the time it is returned
+    bool empty() const;
+
+    // Number of elements when it was checked
+    size_type size() const;
+
+    /****** ALLOCATOR ******/
+
+    // Returns a copy of the allocator used to construct the nodes
+    allocator_type get_allocator() const;
+
+  private:
+
+    struct Node;
+
+    /*
+    @struct: Link
+
+    @brief: The part of a node that traversals lock. The list's head is a
+            lone Link, so that the front is locked like any other node.
+    */
+    struct Link
+    {
+        Link() : next(nullptr) {}
+
+        // Guards next, and the element of the node it belongs to
+        mutable std::mutex lock;
+        Node* next;
+    };
+
+    struct Node : Link
+    {
+        template <class... Args>
+        explicit Node(Args&&... args) : Link(), data(std::forward<Args>(args)...) {}
+
+        value_type data;
+    };
+
+    typedef typename std::allocator_traits<Allocator>::template
+            rebind_alloc<Node>                  node_allocator;
+    typedef std::allocator_traits<node_allocator> node_traits;
+
+    typedef std::unique_lock<std::mutex>    node_lock;
+
+    mutable Link head;
+    std::atomic<size_type> count;
+    node_allocator alloc;
+
+    // Allocates a node, constructing its element from args
+    template <class... Args>
+    Node* create_node(Args&&... args);
+
+    // Destroys and frees node and every node linked after it
+    void destroy_nodes(Node* node);
+
+    // Walks the list hand over hand and stops at the first element
+    // fulfilling the predicate. found is set to the element's node and the
+    // returned lock holds it, or found is null and the lock is released
+    template <class Predicate>
+    node_lock lock_first(Predicate&& pred, Node*& found) const;
+};
+
+#include "concurrent_linked_list.cpp"
+
+#endif //CONCURRENT_LINKED_LIST_H
@@ -0,0 +1,146 @@
+/*
+
+ File: concurrent_mpsc_list.hpp
+
+ Brief: Concurrent MPSC List is a lock-free, unbounded, first in first out
+        work queue for many producer threads and one consumer thread. Any
+        thread may push_back, only the consumer may pop_front. It follows
+        Dmitry Vyukov's non-intrusive MPSC queue: a producer claims the
+        back with a single atomic exchange and then links the node behind
+        it, the consumer unlinks from the front without atomic
+        read-modify-writes. Nodes are laid out like the linear_linked_list's,
+        the element followed by the next pointer, and the front node is an
+        empty sentinel.
+
+        NOTE: Between a producer's exchange and its link, the consumer can
+        reach the elements in front of that producer's node but neither the
+        node nor anything pushed after it. try_pop_front reports an empty
+        list in that window, which lasts a few instructions unless the 
+        producer is preempted.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef CONCURRENT_MPSC_LIST_H
+#define CONCURRENT_MPSC_LIST_H
+
+#include <atomic> // std::atomic
+#include <memory> // std::allocator, std::allocator_traits
+#include <thread> // std::this_thread::yield
+#include <utility> // std::move, std::forward
+#include <type_traits> // std::aligned_storage
+
+template <typename T, class Allocator = std::allocator<T>>
+class concurrent_mpsc_list
+{
+  public:
+
+    /* Type definitions */
+    typedef T                      value_type;
+    typedef T&                     reference;
+    typedef const T&               const_reference;
+    typedef size_t                 size_type;
+    typedef Allocator              allocator_type;
+    typedef concurrent_mpsc_list<T, Allocator>  self_type;
+
+    /****** CONSTRUCTORS ******/
+
+    // Default constructor
+    concurrent_mpsc_list();
+
+    // Allocator constructor, nodes are allocated by a copy of alloc
+    explicit concurrent_mpsc_list(const allocator_type& alloc);
+
+    // Threads hold on to the list, so it is neither copied nor moved
+    concurrent_mpsc_list(const self_type& origin) = delete;
+    self_type& operator=(const self_type& origin) = delete;
+
+    // Destroys the remaining elements, no thread may still be using the list
+    ~concurrent_mpsc_list();
+
+    /****** MODIFIERS ******/
+
+    // Appends an element. Safe to call from any number of threads at once
+    self_type& push_back(const_reference data);
+    self_type& push_back(T&& data);
+
+    // Constructs an element in place at the back. Safe from any thread
+    template <class... Args>
+    self_type& emplace_back(Args&&... args);
+
+    // Moves the front element into out_param and removes it, or returns
+    // false if there is none. Consumer thread only
+    bool try_pop_front(reference out_param);
+
+    // Waits until there is a front element, then moves it into out_param
+    // and removes it. Consumer thread only
+    reference pop_front(reference out_param);
+
+    /****** CAPACITY ******/
+
+    // True if the consumer would find nothing to pop. Consumer thread only,
+    // from other threads the answer may be stale by the time it is returned
+    bool empty() const;
+
+    /****** ALLOCATOR ******/
+
+    // Returns a copy of the allocator used to construct the nodes
+    allocator_type get_allocator() const;
+
+  private:
+
+    /*
+    @struct: Node
+
+    @brief: Holds an element followed by the link to the next node. The
+            element is constructed when the node is pushed and destroyed
+            when it is popped, the node then serves as the sentinel.
+    */
+    struct Node
+    {
+        Node() : next(nullptr) {}
+
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type data;
+        std::atomic<Node*> next;
+
+        T* element() { return reinterpret_cast<T*>(&data); }
+    };
+
+    typedef typename std::allocator_traits<Allocator>::template
+            rebind_alloc<Node>                  node_allocator;
+    typedef std::allocator_traits<node_allocator> node_traits;
+
+    // Producers and the consumer write to opposite ends of the list, so
+    // each end is given its own cache line
+    static const size_type cache_line = 64;
+
+    // The consumer's end, the sentinel before the front element
+    Node* head;
+    char head_padding[cache_line - sizeof(Node*)];
+
+    // The producers' end, the most recently pushed node
+    std::atomic<Node*> tail;
+    char tail_padding[cache_line - sizeof(std::atomic<Node*>)];
+
+    node_allocator alloc;
+
+    // Allocates a node with no element and no successor
+    Node* create_node();
+
+    // Links a node holding a constructed element in at the back
+    void link_back(Node* node);
+
+    // Frees a node whose element has been destroyed or never constructed
+    void destroy_node(Node* node);
+};
+
+#include "concurrent_mpsc_list.cpp"
+
+#endif //CONCURRENT_MPSC_LIST_H
@@ -0,0 +1,190 @@
+/*
+
+ File: concurrent_ordered_set.hpp
+
+ Brief: Concurrent Ordered Set is a lock-free set of unique elements kept in
+        ascending order on a singly linked list, after Tim Harris and Maged
+        Michael. Any number of threads may insert, erase and look up
+        elements at once.
+
+        An element is erased in two steps. The low bit of its node's next
+        pointer is set first, which marks the node as logically deleted
+        and stops any thread from linking after it. The node is then
+        unlinked from its predecessor, by the eraser or by the next thread
+        that walks past it. Since a marked link can never be swung, an
+        insert cannot be lost behind a node being erased.
+
+        Unlinked nodes are reclaimed with Maged Michael's hazard pointers. A
+        walking thread publishes the node it is reading and the node whose
+        link it may swing, and nodes are only freed once no thread has
+        published them.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef CONCURRENT_ORDERED_SET_H
+#define CONCURRENT_ORDERED_SET_H
+
+#include <atomic> // std::atomic
+#include <memory> // std::allocator, std::allocator_traits
+#include <cstdint> // std::uintptr_t
+#include <utility> // std::move, std::forward
+#include <functional> // std::less
+#include "hazard_domain.hpp"
+
+template <typename T, class Compare = std::less<T>, class Allocator = std::allocator<T>>
+class concurrent_ordered_set
+{
+  public:
+
+    /* Type definitions */
+    typedef T                      value_type;
+    typedef T&                     reference;
+    typedef const T&               const_reference;
+    typedef size_t                 size_type;
+    typedef Compare                value_compare;
+    typedef Allocator              allocator_type;
+    typedef concurrent_ordered_set<T, Compare, Allocator>  self_type;
+
+    /****** CONSTRUCTORS ******/
+
+    // Default constructor
+    concurrent_ordered_set();
+
+    // Orders the elements with comp, nodes are allocated by a copy of alloc
+    explicit concurrent_ordered_set(const value_compare& comp,
+                                    const allocator_type& alloc = allocator_type());
+
+    // Threads hold on to the set, so it is neither copied nor moved
+    concurrent_ordered_set(const self_type& origin) = delete;
+    self_type& operator=(const self_type& origin) = delete;
+
+    // Destroys the elements, no thread may still be using the set
+    ~concurrent_ordered_set();
+
+    /****** MODIFIERS ******/
+
+    // Adds the element in order, returns false if an equivalent element is
+    // already in the set. Safe from any thread
+    bool insert(const_reference data);
+    bool insert(T&& data);
+
+    // Constructs an element and adds it in order, the element is destroyed
+    // if an equivalent element is already in the set
+    template <class... Args>
+    bool emplace(Args&&... args);
+
+    // Removes the element equivalent to target, returns false if there is
+    // none. Safe from any thread
+    bool erase(const_reference target);
+
+    /****** LOOKUP ******/
+
+    // Returns true if an element equivalent to target is in the set
+    bool contains(const_reference target) const;
+
+    /****** CAPACITY ******/
+
+    // True if the set held no elements when it was checked, other threads
+    // may have changed that by the time it is returned
+    bool empty() const;
+
+    // Number of elements when it was checked
+    size_type size() const;
+
+    /****** OBSERVERS ******/
+
+    // Returns a copy of the comparison that orders the elements
+    value_compare value_comp() const;
+
+    // Returns a copy of the allocator used to construct the nodes
+    allocator_type get_allocator() const;
+
+  private:
+
+    struct Node
+    {
+        template <class... Args>
+        explicit Node(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr) {}
+
+        value_type data;
+
+        // The low bit is set once the node is logically deleted
+        std::atomic<Node*> next;
+    };
+
+    typedef typename std::allocator_traits<Allocator>::template
+            rebind_alloc<Node>                  node_allocator;
+    typedef std::allocator_traits<node_allocator> node_traits;
+
+    // Destroys the element of an unlinked node and frees it
+    struct node_deleter
+    {
+        void operator()(Node* node)
+        {
+            node_traits::destroy(alloc, node);
+            node_traits::deallocate(alloc, node, 1);
+        }
+
+        node_allocator alloc;
+    };
+
+    // Each walking thread publishes the node it reads and its predecessor
+    static const size_type hazards_per_record = 2;
+
+    typedef hazard_domain<Node, node_deleter, node_allocator, hazards_per_record> domain_type;
+    typedef typename domain_type::hazard_record   hazard_record;
+
+    /*
+    @struct: window
+
+    @brief: Where a search stopped: the link that points at current, and
+            current, the first node not ordered before the target. Both
+            current and the node owning prev are published by the searcher.
+    */
+    struct window
+    {
+        std::atomic<Node*>* prev;
+        Node* current;
+    };
+
+    // Every thread reads the head, keep it apart from the other members
+    static const size_type cache_line = 64;
+
+    mutable std::atomic<Node*> head;
+    char head_padding[cache_line - sizeof(std::atomic<Node*>)];
+
+    std::atomic<size_type> count;
+    value_compare comp;
+    mutable node_allocator alloc;
+
+    // Lookups publish nodes too, so the domain is used by const members
+    mutable domain_type domain;
+
+    // Marked pointer helpers, the mark lives in the low bit of a link
+    static bool is_marked(const Node* node);
+    static Node* marked(Node* node);
+    static Node* unmarked(Node* node);
+
+    // Walks the list to the first node not ordered before target, unlinking
+    // marked nodes on the way. Returns true if that node is equivalent to
+    // target. The window's nodes stay published in record
+    bool search(hazard_record* record, const_reference target, window& found) const;
+
+    // Links node in order, or destroys it if an equivalent element exists
+    bool link(Node* node);
+
+    // Destroys the element and frees the node
+    void destroy_node(Node* node) const;
+};
+
+#include "concurrent_ordered_set.cpp"
+
+#endif //CONCURRENT_ORDERED_SET_H
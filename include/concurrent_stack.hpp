@@ -0,0 +1,132 @@
+/*
+
+ File: concurrent_stack.hpp
+
+ Brief: Concurrent Stack is a lock-free last in first out stack, after
+        R. Kent Treiber, that any number of threads may push_front to and
+        pop_front from at once. Its nodes are the linear_linked_list's nodes,
+        so pop_all can take every element with one atomic exchange and
+        return them as a linear_linked_list without copying.
+
+        Popped nodes are reclaimed with Maged Michael's hazard pointers. A
+        thread publishes the node it is about to read before reading it,
+        and popped nodes are only freed once no thread has published them.
+        This also rules out the ABA problem: a node cannot be freed and
+        reallocated at the same address while a thread is comparing
+        against it.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef CONCURRENT_STACK_H
+#define CONCURRENT_STACK_H
+
+#include <atomic> // std::atomic
+#include <memory> // std::allocator, std::allocator_traits
+#include <thread> // std::this_thread::yield
+#include <utility> // std::move, std::forward
+#include "linear_linked_list.hpp"
+#include "hazard_domain.hpp"
+
+template <typename T, class Allocator = std::allocator<T>>
+class concurrent_stack
+{
+  public:
+
+    /* Type definitions */
+    typedef T                      value_type;
+    typedef T&                     reference;
+    typedef const T&               const_reference;
+    typedef size_t                 size_type;
+    typedef Allocator              allocator_type;
+    typedef concurrent_stack<T, Allocator>      self_type;
+    typedef linear_linked_list<T, Allocator>    list_type;
+
+    /****** CONSTRUCTORS ******/
+
+    // Default constructor
+    concurrent_stack();
+
+    // Allocator constructor, nodes are allocated by a copy of alloc
+    explicit concurrent_stack(const allocator_type& alloc);
+
+    // Threads hold on to the stack, so it is neither copied nor moved
+    concurrent_stack(const self_type& origin) = delete;
+    self_type& operator=(const self_type& origin) = delete;
+
+    // Destroys the remaining elements, no thread may still be using the stack
+    ~concurrent_stack();
+
+    /****** MODIFIERS ******/
+
+    // Pushes an element onto the top. Safe from any thread
+    self_type& push_front(const_reference data);
+    self_type& push_front(T&& data);
+
+    // Constructs an element in place on the top. Safe from any thread
+    template <class... Args>
+    self_type& emplace_front(Args&&... args);
+
+    // Moves the top element into out_param and removes it, or returns false
+    // if the stack is empty. Safe from any thread. If moving the element
+    // throws, the element is lost
+    bool try_pop_front(reference out_param);
+
+    // Waits until there is a top element, then pops it into out_param
+    reference pop_front(reference out_param);
+
+    // Takes every element with a single exchange of the top, and returns
+    // them top first as a list using this stack's allocator. Safe from any
+    // thread, the stack is left empty for the pushes that follow
+    list_type pop_all();
+
+    /****** CAPACITY ******/
+
+    // True if the stack held no elements when it was checked, other threads
+    // may have changed that by the time it is returned
+    bool empty() const;
+
+    /****** ALLOCATOR ******/
+
+    // Returns a copy of the allocator used to construct the nodes
+    allocator_type get_allocator() const;
+
+  private:
+
+    typedef typename list_type::Node              Node;
+    typedef typename list_type::node_allocator    node_allocator;
+    typedef typename list_type::node_traits       node_traits;
+
+    // Frees a popped node, its element was destroyed when it was popped
+    struct node_deleter
+    {
+        void operator()(Node* node) { node_traits::deallocate(alloc, node, 1); }
+
+        node_allocator alloc;
+    };
+
+    typedef hazard_domain<Node, node_deleter, node_allocator> domain_type;
+    typedef typename domain_type::hazard_record   hazard_record;
+
+    // Every thread writes to the top, keep it apart from the other members
+    static const size_type cache_line = 64;
+
+    std::atomic<Node*> top;
+    char top_padding[cache_line - sizeof(std::atomic<Node*>)];
+
+    node_allocator alloc;
+
+    // Each thread publishes the node it pops in a record of the domain
+    domain_type domain;
+};
+
+#include "concurrent_stack.cpp"
+
+#endif //CONCURRENT_STACK_H
@@ -0,0 +1,138 @@
+/*
+
+ File: hazard_domain.hpp
+
+ Brief: Hazard Domain is the internal bookkeeping behind Maged Michael's
+        hazard pointers, shared by the lock-free containers. A thread
+        claims a record for the length of one operation and publishes in
+        it the nodes it is about to read. Nodes it unlinks are retired to
+        the record and only freed once no thread has published them.
+
+        Retiring and reclaiming never allocate while there is room in the
+        record's queue, which is reserved when the record is added, so an
+        unlinked node cannot be lost to a bad_alloc.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef HAZARD_DOMAIN_H
+#define HAZARD_DOMAIN_H
+
+#include <atomic> // std::atomic
+#include <memory> // std::allocator_traits
+#include <thread> // std::this_thread::yield
+#include <vector> // std::vector
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uintptr_t
+#include <algorithm> // std::sort, std::lower_bound
+
+// Deleter frees an unlinked node, Allocator is rebound to allocate records
+template <class Node, class Deleter, class Allocator, std::size_t Hazards = 1>
+class hazard_domain
+{
+  public:
+
+    /* Type definitions */
+    typedef std::size_t            size_type;
+    typedef Deleter                deleter_type;
+    typedef Allocator              allocator_type;
+    typedef hazard_domain<Node, Deleter, Allocator, Hazards>  self_type;
+
+    typedef typename std::allocator_traits<Allocator>::template
+            rebind_alloc<Node*>                 pointer_allocator;
+    typedef std::vector<Node*, pointer_allocator> pointer_vector;
+
+    /*
+    @struct: hazard_record
+
+    @brief: One thread's hazard pointers and the nodes it has unlinked but
+            not yet freed. Records are kept until the domain is destroyed,
+            so that a thread can always read a record it found in the list.
+    */
+    struct hazard_record
+    {
+        explicit hazard_record(const pointer_allocator& alloc)
+            : active(true), next(nullptr), retired(alloc)
+        {
+            for (std::atomic<Node*>& hazard : hazards)
+            {
+                hazard.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        std::atomic<Node*> hazards[Hazards];
+        std::atomic<bool> active;
+        hazard_record* next;
+
+        // Unlinked nodes. Their next pointers may still be read by threads
+        // that published them, so they are not relinked
+        pointer_vector retired;
+    };
+
+    /****** CONSTRUCTORS ******/
+
+    // Nodes are freed by a copy of free, records are allocated by a copy of
+    // alloc
+    hazard_domain(const deleter_type& free, const allocator_type& alloc);
+
+    // Threads hold on to the domain, so it is neither copied nor moved
+    hazard_domain(const self_type& origin) = delete;
+    self_type& operator=(const self_type& origin) = delete;
+
+    // Frees every retired node and record, no thread may still be using them
+    ~hazard_domain();
+
+    /****** RECORDS ******/
+
+    // Claims an inactive record, or adds a new one
+    hazard_record* acquire_record();
+
+    // Clears the record's hazards and returns it for another thread to claim
+    void release_record(hazard_record* record);
+
+    /****** RECLAMATION ******/
+
+    // Queues an unlinked node for freeing, freeing the record's queue when
+    // full. The node must have been unlinked by a sequentially consistent
+    // operation, so that the scan of the hazards that frees it sees every
+    // thread that published it before. Never allocates unless every queued
+    // node is still published
+    void retire(hazard_record* record, Node* node);
+
+    // Waits until each hazard published when called has been cleared or
+    // replaced
+    void wait_for_published() const;
+
+  private:
+
+    typedef typename std::allocator_traits<Allocator>::template
+            rebind_alloc<hazard_record>         record_allocator;
+    typedef std::allocator_traits<record_allocator> record_traits;
+
+    // A record frees its retired nodes once it has collected this many, the
+    // queue only grows if all of them are still published
+    static const size_type retire_threshold = 64;
+
+    std::atomic<hazard_record*> records;
+    deleter_type free;
+    record_allocator alloc;
+
+    // Frees each retired node of the record that no thread has published
+    void reclaim(hazard_record* record);
+
+    // Marks a node published while reclaiming, in the low bit of its address
+    static bool is_marked(const Node* node);
+    static Node* marked(Node* node);
+    static Node* unmarked(Node* node);
+};
+
+#include "hazard_domain.cpp"
+
+#endif //HAZARD_DOMAIN_H
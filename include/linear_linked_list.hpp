@@ -22,12 +22,43 @@
 #ifndef LINKED_LIST_H
 #define LINKED_LIST_H
 
+#include <thread> // std::thread
+#include <vector> // std::vector
+#include <exception> // std::exception_ptr
+#include <system_error> // std::system_error
+#include <memory> // std::allocator, std::allocator_traits
+#include <cstddef> // std::ptrdiff_t
+#include <iterator> // std::iterator_traits, std::forward_iterator_tag
 #include <utility> // std::move, std::exchange
-#include <algorithm> // std::swap
+#include <type_traits> // std::is_empty, std::integral_constant
+#include <algorithm> // std::swap, std::sort
 #include <stdexcept> // std::logic_error
 #include <initializer_list>  // std::initializer_list
 
-template <typename T>
+// Polymorphic allocators are only available from C++17
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource> // std::pmr::polymorphic_allocator
+#define LINKED_LIST_HAS_PMR
+#endif
+#endif
+
+// Node statistics and hop profiling are opt-in, define LINKED_LIST_STATISTICS
+// or LINKED_LIST_PROFILING to keep them
+#if defined(LINKED_LIST_STATISTICS) || defined(LINKED_LIST_PROFILING)
+#include <atomic> // std::atomic
+#endif
+
+// Nodes the traversals prefetch ahead of the node they are on, 0 disables 
+// prefetching. Prefetches are only issued by GCC and Clang builds
+#ifndef LINKED_LIST_PREFETCH_DISTANCE
+#define LINKED_LIST_PREFETCH_DISTANCE 0
+#endif
+
+template <typename T, class Allocator>
+class concurrent_stack;
+
+template <typename T, class Allocator = std::allocator<T>>
 class linear_linked_list
 {
   public:
@@ -43,35 +74,62 @@ class linear_linked_list
     typedef const T&               const_reference;
     typedef const T*               const_pointer;
     typedef size_t                 size_type;
+    typedef Allocator              allocator_type;
     typedef forward_iterator       iterator;
     typedef const_forward_iterator const_iterator;
-    typedef linear_linked_list<T>  self_type;
+    typedef linear_linked_list<T, Allocator>  self_type;
+
+    // Selects how sort orders the nodes
+    enum class sort_strategy
+    {
+        automatic, // gather for long lists made of many runs
+        merge,     // natural merge sort, relinks nodes in place
+        gather     // sorts an array of node pointers, then relinks once
+    };
+
+    // Lists shorter than this are always merge sorted by automatic
+    static const size_type gather_threshold = 4096;
+
+    // parallel_sort gives each thread at least this many elements
+    static const size_type parallel_grain = 16384;
+
+    // Default prefetch distance of for_each, accumulate and the traversals
+    // inside operations, see LINKED_LIST_PREFETCH_DISTANCE
+    static const size_type prefetch_distance = LINKED_LIST_PREFETCH_DISTANCE;
 
     /****** CONSTRUCTORS ******/
 
     // Default
     linear_linked_list();
 
-    // Ranged based
+    // Empty list that allocates its nodes with the provided allocator
+    explicit linear_linked_list(const allocator_type& alloc);
+
+    // Ranged based. Forward ranges are counted first so that their nodes can
+    // be acquired together, see assign
     template <class InputIterator>
-    linear_linked_list(InputIterator begin, InputIterator end);
+    linear_linked_list(InputIterator begin, InputIterator end, 
+                       const allocator_type& alloc = allocator_type());
 
     // Initializer List
-    explicit linear_linked_list(std::initializer_list<value_type> init);
+    explicit linear_linked_list(std::initializer_list<value_type> init,
+                                const allocator_type& alloc = allocator_type());
 
-    // Copy Constructor
+    // Copy Constructor, the copy's nodes are acquired together, see assign
     linear_linked_list(const self_type& origin);
+    linear_linked_list(const self_type& origin, const allocator_type& alloc);
 
     // Move Constructor
     linear_linked_list(self_type&& origin);
+
+    // Moves the elements one at a time if alloc does not equal the origin's
+    linear_linked_list(self_type&& origin, const allocator_type& alloc);
    
     // Destructor
     ~linear_linked_list();
      
     /****** MODIFIERS ******/
 
-    // TODO add push_front/back methods for lists and iterators
-
     // Adds an element to the front of the list
     self_type& push_front(T&& data);
     self_type& push_front(const_reference data);
@@ -80,6 +138,18 @@ class linear_linked_list
     self_type& push_back(T&& data);
     self_type& push_back(const_reference data);
 
+    // Constructs an element in place at the front of the list
+    template <class... Args>
+    reference emplace_front(Args&&... args);
+
+    // Constructs an element in place at the back of the list
+    template <class... Args>
+    reference emplace_back(Args&&... args);
+
+    // Constructs an element in place after pos, throws if pos is the end
+    template <class... Args>
+    iterator emplace_after(const_iterator pos, Args&&... args);
+
     // Removes the element at the front of the list
     self_type& pop_front();
 
@@ -91,24 +161,113 @@ class linear_linked_list
     // Removes each element from the container
     self_type& clear();
 
+    // Replaces the elements with copies of [first, last), which must not be
+    // in this list. The existing elements are copy assigned in place, so 
+    // nodes are only created or destroyed for the difference in length.
+    // When the length is known, as it is for forward iterators and 
+    // initializer lists, added nodes are acquired in batches before the
+    // batch's elements are copied: spare nodes first, then the rest are
+    // allocated back to back, so the nodes stay adjacent in memory even if
+    // copying an element allocates. If deallocating through the allocator 
+    // does nothing, as with a std::pmr::monotonic_buffer_resource, the rest
+    // are allocated as one block. If T's copy assignment cannot throw, 
+    // assigning a known length either succeeds or leaves the list unchanged
+    template <class InputIterator>
+    self_type& assign(InputIterator first, InputIterator last);
+
+    self_type& assign(std::initializer_list<value_type> init);
+
     // Reverses the order of elements
     self_type& reverse();
 
-    // Sorts the list, defaults to ascending order
-    self_type& sort();
+    // Sorts the list, defaults to ascending order. The merge strategy is a
+    // bottom-up natural merge sort: ascending and strictly descending runs
+    // are found in one pass and merged as a binary counter, so input made of
+    // r runs sorts in O(n log r) without allocating. The gather strategy
+    // copies node pointers into a temporary array, introsorts it, and
+    // relinks the nodes in one pass, which touches each node fewer times.
+    // Gather falls back to merge if the array cannot be allocated. Only the
+    // merge strategy keeps equal elements in their original order
+    self_type& sort(sort_strategy strategy = sort_strategy::automatic);
 
     template <class Compare>
-    self_type& sort(Compare&& comp);
+    self_type& sort(Compare&& comp, sort_strategy strategy = sort_strategy::automatic);
 
-    // Splits the list on the parameter and returns the split
+    // Sorts the list like sort, but equal elements always keep their 
+    // original order. The gather strategy uses std::stable_sort, which may
+    // allocate a buffer of node pointers outside the list's allocator
+    self_type& stable_sort(sort_strategy strategy = sort_strategy::automatic);
+
+    template <class Compare>
+    self_type& stable_sort(Compare&& comp, 
+                           sort_strategy strategy = sort_strategy::automatic);
+
+    // Stable sorts the list in order of proj(element), defaults to ascending
+    // order. Each key is computed once: the keys are copied into a temporary
+    // array alongside their node pointers, the array is stable sorted, and
+    // the nodes are relinked in one pass. If the array cannot be allocated
+    // the list is merge sorted, computing the keys on every comparison
+    template <class Projection>
+    self_type& sort_by(Projection&& proj);
+
+    template <class Projection, class Compare>
+    self_type& sort_by(Projection&& proj, Compare&& comp);
+
+    // Sorts the list in ascending order of key(element), which must return
+    // an integral type. A stable LSD radix sort that makes no comparisons and
+    // is O(n * passes), one pass per byte of the key. Bytes that are equal in
+    // every key are skipped. The merge strategy relinks the nodes into 256 
+    // bucket lists each pass and concatenates the buckets, allocating 
+    // nothing. The gather strategy copies each key and node pointer into a 
+    // temporary array once and sorts the array, so only the gathering and 
+    // relinking passes chase pointers. Gather falls back to merge if the 
+    // arrays cannot be allocated
+    template <class KeyFunction>
+    self_type& sort_by_key(KeyFunction&& key, 
+                           sort_strategy strategy = sort_strategy::automatic);
+
+    // Sorts the list on up to threads threads, 0 uses every hardware thread.
+    // The list is cut into one balanced chunk per thread, the chunks are
+    // sorted concurrently, then merged pairwise in a tree of merges that also
+    // runs concurrently. comp is called from several threads at once. Chunks
+    // are merge sorted unless the allocator is std::allocator, so that other
+    // allocators are never used concurrently. Requesting more threads than
+    // the hardware runs slows the sort, the chunks evict each other's nodes.
+    // If comp throws, every node is left in the list in unspecified order
+    self_type& parallel_sort(size_type threads = 0);
+
+    // Disabled for integers so that parallel_sort(4) selects the overload above
+    template <class Compare, class = typename std::enable_if<
+              !std::is_integral<typename std::decay<Compare>::type>::value>::type>
+    self_type& parallel_sort(Compare&& comp, size_type threads = 0);
+
+    // Splits the list on the parameter and returns the split. The split off
+    // elements are counted, so this is linear in the size of the split
     self_type split(const_iterator pos);
 
-    // Merges list into this list
+    // Merges list into this list, both lists' allocators must compare equal.
+    // Stable, elements of this list come before equal elements of list. If
+    // comp throws, every node of both lists is left in this list unsorted
     self_type& merge(self_type& list);
 
     template <class Compare>
     self_type& merge(self_type& list, Compare&& comp);
 
+    // Moves every node of other after pos in constant time. Throws if pos is
+    // the end, both lists' allocators must compare equal
+    self_type& splice_after(const_iterator pos, self_type& other);
+
+    // Moves the nodes in (first, last] of other after pos. Unlike
+    // std::forward_list, last is included, so no node needs to be searched
+    // for. Moving between lists counts the range, O(last - first); within a
+    // list it is constant time. pos must not lie in (first, last]
+    self_type& splice_after(const_iterator pos, self_type& other,
+                            const_iterator first, const_iterator last);
+
+    // Links the nodes of other to the back or front of this list, O(1)
+    self_type& append(self_type&& other);
+    self_type& prepend(self_type&& other);
+
     iterator erase_after(iterator pos);
 
     // Removes all items matching target, returns number of items removed
@@ -123,9 +282,26 @@ class linear_linked_list
     // returns true if the list is empty
     bool empty() const;
 
-    // returns length of list by recurring through the list. O(n) operation.
+    // returns the number of elements, the count is kept so this is O(1)
     size_type size() const;
 
+    // Opts into node recycling. Allocates nodes until n spare nodes are pooled
+    // and keeps up to n nodes freed by pop_front, erase_after, remove_if and
+    // clear for reuse by later insertions instead of deallocating them
+    self_type& reserve(size_type n);
+
+    // Deallocates every pooled node and stops recycling freed nodes
+    self_type& shrink_to_fit();
+
+    // Opts the calling thread into a node cache shared by every list of this
+    // type on the thread. Allocates nodes until n spare nodes are cached and 
+    // keeps up to n nodes freed by any list's clear or destructor for reuse by
+    // any other list. Requires a stateless allocator.
+    static void reserve_thread_cache(size_type n);
+
+    // Deallocates the calling thread's cached nodes and stops caching
+    static void release_thread_cache();
+
     /****** ELEMENT ACCESS ******/
 
     // Returns a direct reference to the front element, throws if list is empty
@@ -148,6 +324,106 @@ class linear_linked_list
     iterator middle();
     const_iterator middle() const;
 
+    /****** TRAVERSAL ******/
+
+    // Calls f with each element in order and returns f. The node distance
+    // ahead is prefetched, so that on lists scattered across the heap its 
+    // cache miss overlaps with the work on the current elements
+    template <class Function>
+    Function for_each(Function f, size_type distance = prefetch_distance);
+
+    template <class Function>
+    Function for_each(Function f, size_type distance = prefetch_distance) const;
+
+    // Returns op(...op(op(init, first), second)..., last), prefetching 
+    // like for_each
+    template <typename U, class BinaryOperation>
+    U accumulate(U init, BinaryOperation op, size_type distance = prefetch_distance) const;
+
+#ifdef LINKED_LIST_STATISTICS
+
+    /****** STATISTICS ******/
+
+    /*
+    @struct: statistics
+
+    @brief: Node counters, only kept when LINKED_LIST_STATISTICS is defined.
+            A node is freed when it is deallocated, or dropped because 
+            deallocating it would do nothing. Live nodes hold memory: the
+            elements and spare nodes.
+    */
+    struct statistics
+    {
+        size_type nodes_allocated;
+        size_type nodes_freed;
+        size_type live_nodes;
+        size_type peak_live_nodes;
+
+        // sizeof the node, including any padding around the element
+        size_type bytes_per_node;
+    };
+
+    // Counters for this list. Its live nodes are its elements and pooled 
+    // nodes, the peak counts nodes received from other lists too
+    statistics stats() const;
+
+    // Counters for every list of this type, on every thread. Live nodes
+    // include the nodes in thread caches
+    static statistics type_stats();
+
+#endif // LINKED_LIST_STATISTICS
+
+    /****** PROFILING ******/
+
+    // Operations that walk the list. When LINKED_LIST_PROFILING is defined,
+    // each call is measured in node hops, the next pointers it follows
+    enum class operation
+    {
+        copy, assign, clear, reverse, sort, stable_sort, sort_by, sort_by_key,
+        parallel_sort, merge, split, splice_after, remove, remove_if, middle,
+        equality
+    };
+
+    static const size_type operation_count = 
+        static_cast<size_type>(operation::equality) + 1;
+
+#ifdef LINKED_LIST_PROFILING
+
+    static const size_type hop_buckets = 32;
+
+    /*
+    @struct: operation_profile
+
+    @brief: Totals for one operation over every list of this type. Bucket 0
+            of the histogram counts calls that made no hops, bucket b counts
+            calls that made 2^(b-1) to 2^b - 1 hops, and the last bucket 
+            also counts every longer call.
+    */
+    struct operation_profile
+    {
+        size_type calls;
+        size_type hops;
+        size_type histogram[hop_buckets];
+    };
+
+    // Hops are counted for the outermost operation on the calling thread, 
+    // operations called inside it are part of it. Hops made by 
+    // parallel_sort's worker threads are counted as part of parallel_sort
+    static operation_profile profile(operation op);
+
+    // The operation's name, e.g. "sort_by_key"
+    static const char* operation_name(operation op);
+
+    // Zeroes every operation's totals
+    static void reset_profile();
+
+#endif // LINKED_LIST_PROFILING
+
+    /****** ALLOCATOR ******/
+
+    // Returns a copy of the allocator used to construct the nodes
+    allocator_type get_allocator() const;
+
     /****** COMPARISON OPERATORS ******/
 
     // Compares sizes, then comapres each element of the list for equality
@@ -159,13 +435,24 @@ class linear_linked_list
     /****** COPY-ASSIGNMENT AND SWAP ******/
 
     // Swaps pointers to each other's resources. effectively reassigning 
-    // ownership.
+    // ownership. Allocators are swapped only if propagate_on_container_swap
     void swap(self_type& origin);
 
-    // creates a copy of the origin, then swaps ownership with the copy
-    self_type& operator=(self_type copy);
+    // Copy assigns the origin's elements over this list's elements, see 
+    // assign. The origin's allocator is adopted if 
+    // propagate_on_container_copy_assignment. If that allocator does not
+    // compare equal to this list's, the nodes cannot be reused: a copy is 
+    // made with it and ownership is swapped with the copy
+    self_type& operator=(const self_type& origin);
+
+    // Takes ownership of the origin's nodes if the allocator propagates or the
+    // allocators are equal, otherwise moves the elements one at a time
+    self_type& operator=(self_type&& origin);
 
   private:
+
+    // Shares the node type, so that pop_all can hand its nodes to a list
+    friend class concurrent_stack<T, Allocator>;
     
     /* 
     @struct: Node
@@ -175,23 +462,108 @@ class linear_linked_list
     */
     struct Node
     {
-        // Default values are default constructor and nullptr
-        Node(const_reference value = value_type(), Node* next = nullptr) 
-            : data(value), next(next) {}
-
-        // rvalue constructor
-        Node(T&& value, Node* next = nullptr)
-            : data(std::forward<T>(value)), next(next) {}
+        // Constructs data in place from args, T need not be default constructible
+        template <class... Args>
+        Node(Node* next, Args&&... args)
+            : data(std::forward<Args>(args)...), next(next) {}
 
         value_type data;
         Node* next;
 
     };
 
+    typedef typename std::allocator_traits<Allocator>::template 
+            rebind_alloc<Node>                  node_allocator;
+    typedef std::allocator_traits<node_allocator> node_traits;
+
     Node* head;
     Node* tail;
 
-    /* Recursive Functions */
+    // Number of elements, create_node and destroy_node keep it current
+    size_type count;
+
+    node_allocator alloc;
+
+    // Spare nodes linked through next, their data has already been destroyed
+    Node* pool;
+    size_type pool_size;
+    size_type pool_capacity;
+
+#ifdef LINKED_LIST_STATISTICS
+    size_type nodes_allocated = 0;
+    size_type nodes_freed = 0;
+    size_type peak_live_nodes = 0;
+
+    // Totals for every list of this type, updated from any thread
+    struct type_counters
+    {
+        std::atomic<size_type> allocated;
+        std::atomic<size_type> freed;
+        std::atomic<size_type> peak_live;
+    };
+
+    static type_counters& type_totals();
+#endif
+
+    /*
+    @struct: node_cache
+
+    @brief: Spare nodes shared by every list of this type on one thread. Nodes
+            from one stateless allocator can be freed by any other instance,
+            so the cache is only available to lists with stateless allocators.
+    */
+    struct node_cache
+    {
+        node_cache() : nodes(nullptr), size(0), capacity(0) {}
+
+        // Frees the cached nodes as the thread exits, lists destroyed after 
+        // this point see the cache state and free their nodes directly
+        ~node_cache() { release(); capacity = 0; thread_cache_state() = cache_state::destroyed; }
+
+        void release();
+
+        Node* nodes;
+        size_type size;
+        size_type capacity;
+    };
+
+    typedef std::integral_constant<bool, 
+            std::is_empty<node_allocator>::value> shares_nodes;
+
+    static node_cache& thread_cache();
+
+    // Whether the calling thread opted in to its cache. The state is trivially
+    // destructible, so checking it costs no initialization guard, and it is
+    // still readable after the cache itself is destroyed
+    enum class cache_state : unsigned char { off, on, destroyed };
+
+    static cache_state& thread_cache_state();
+
+    // True if deallocating through alloc does nothing, in which case nodes 
+    // are dropped on clear and destruction rather than deallocated one by one
+    template <class NodeAllocator>
+    static bool deallocation_is_noop(const NodeAllocator&) { return false; }
+
+#ifdef LINKED_LIST_HAS_PMR
+    template <class U>
+    static bool deallocation_is_noop(const std::pmr::polymorphic_allocator<U>& alloc)
+    {
+        return dynamic_cast<std::pmr::monotonic_buffer_resource*>(alloc.resource()) 
+               != nullptr;
+    }
+#endif
+
+    // A sorted chain of nodes, null terminated at tail
+    struct run
+    {
+        Node* head;
+        Node* tail;
+    };
+
+    // Sort keeps at most one pending run per level, enough for any list
+    static const size_type sort_levels = sizeof(size_type) * 8;
+
+    /* Helper Functions, each uses constant stack space */
 
     size_type size(Node* head) const;
 
@@ -205,17 +577,242 @@ class linear_linked_list
 
     void reverse(Node* current, Node* prev=nullptr);
 
+    // Runs task(0) to task(tasks - 1), each on its own thread. Rethrows the
+    // first exception a task threw once every task has finished. Hops made
+    // by the other threads are counted on the calling thread
+    template <class Task>
+    static void run_parallel(size_type tasks, Task&& task);
+
+    // Radix sorts by relinking the nodes into bucket lists, see sort_by_key.
+    // Bytes of radix(element) that are clear in differs are skipped
+    template <class Radix, class Key>
+    void bucket_sort(Radix&& radix, Key differs);
+
+    // Radix sorts an array of keys and node pointers, returns false if it
+    // cannot allocate
+    template <class Radix, class Key>
+    bool gather_bucket_sort(Radix&& radix, Key differs);
+
+    // Resolves the automatic strategy and sorts, see sort and stable_sort
+    template <class Compare>
+    void sort_nodes(Compare&& comp, sort_strategy strategy, bool stable);
+
+    // Sorts by relinking runs, see sort. Always stable
+    template <class Compare>
+    void merge_sort(Compare&& comp);
+
+    // Sorts an array of node pointers, returns false if it cannot allocate
+    template <class Compare>
+    bool gather_sort(Compare&& comp, bool stable);
+
+    // True if the list is made of at most size() / 64 runs, counted as
+    // merge sort would find them. Stops counting at the limit
     template <class Compare>
-    Node* merge(Node* self, Node* other, Compare&& comp);
+    bool mostly_sorted(Compare&& comp) const;
+
+    // Merges the sorted run other into self and leaves other empty. Stable,
+    // self's elements come before other's equal elements. If comp throws,
+    // self still holds every node of both runs as one unsorted chain
+    template <class Compare>
+    void merge(run& self, run& other, Compare&& comp);
+
+    // Appends other's nodes after self's, either run may be empty
+    static void link_runs(run& self, run other);
+
+    // Unlinks the run starting at current and sets current to the node after
+    // it. Strictly descending runs are reversed as they are collected. If
+    // comp throws, nothing is unlinked and current is the chain's new front
+    template <class Compare>
+    run take_run(Node*& current, Compare&& comp);
+
+    // Takes over the nodes of a merge of this list and list, see merge
+    void adopt_merged(run merged, self_type& list);
 
     template <class Predicate>
     int remove_if(Predicate&& pred, Node*& current, Node* prev=nullptr);
 
     /* Subroutines */
 
+    // Copy assigns [first, last) over the list's elements, see assign
+    template <class InputIterator>
+    void assign_range(InputIterator first, InputIterator last, std::input_iterator_tag);
+
+    template <class ForwardIterator>
+    void assign_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag);
+
+    // Copy assigns the n elements from first over the list's elements, then
+    // appends or destroys nodes for the difference, see assign
+    template <class ForwardIterator>
+    void assign_copies(ForwardIterator first, size_type n);
+
+    // Destroys every node after last, or every node if last is nullptr, 
+    // leaving remaining elements
+    void truncate_after(Node* last, size_type remaining);
+
+    // Appends copies of [first, last), forward ranges are counted first
+    template <class InputIterator>
+    void append_range(InputIterator first, InputIterator last, std::input_iterator_tag);
+
+    template <class ForwardIterator>
+    void append_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag);
+
+    // Appends copies of the n elements from first. Nodes are acquired in
+    // batches before any element of the batch is copied, see assign
+    template <class ForwardIterator>
+    void append_copies(ForwardIterator first, size_type n);
+
+    // Nodes acquired at a time by append_copies, small enough to stay cached
+    static const size_type copy_batch = 64;
+
+    // Hints that node will be read soon, does nothing without GCC or Clang
+    static void prefetch(const Node* node);
+
+    /*
+    @class: lookahead
+
+    @brief: Runs a fixed number of nodes ahead of a traversal, prefetching
+            each node it reaches so that it is cached when the traversal 
+            gets there. The lookahead itself still waits on each next 
+            pointer, so a distance gains the most when each element takes 
+            some work. A distance of 0 does nothing.
+    */
+    class lookahead
+    {
+      public:
+
+        lookahead(const Node* start, size_type distance);
+
+        // Moves one node further, call once per node the traversal advances
+        void advance();
+
+      private:
+
+        const Node* ahead;
+    };
+
     self_type& push_front(Node* node);
     self_type& push_back(Node* node);
 
+    // Constructs a node, reusing a pooled or cached node before allocating
+    template <class... Args>
+    Node* create_node(Node* next, Args&&... args);
+
+    // Destroys a node's data, then recycles its memory
+    void destroy_node(Node* node);
+
+    // Moves a node without data into the pool, the thread cache, or frees it
+    void recycle_node(Node* node);
+
+    // Takes a node without data from the pool or the thread cache
+    Node* take_spare_node();
+
+    // Thread cache operations, which compile to nothing for stateful allocators
+    static Node* take_cached_node(std::true_type);
+    static Node* take_cached_node(std::false_type) { return nullptr; }
+
+    static size_type cache_room(std::true_type);
+    static size_type cache_room(std::false_type) { return 0; }
+
+    static void cache_nodes(Node* first, Node* last, size_type count, std::true_type);
+    static void cache_nodes(Node*, Node*, size_type, std::false_type) {}
+
+    // Deallocates each pooled node
+    void release_pool();
+
+    // Statistics hooks, which compile to nothing without LINKED_LIST_STATISTICS.
+    // Record n nodes allocated or freed by this list, or by no list in 
+    // particular, and the number of nodes this list holds
+#ifdef LINKED_LIST_STATISTICS
+    void note_allocated(size_type n);
+    void note_freed(size_type n);
+    static void note_type_allocated(size_type n);
+    static void note_type_freed(size_type n);
+    void note_held();
+#else
+    void note_allocated(size_type) {}
+    void note_freed(size_type) {}
+    static void note_type_allocated(size_type) {}
+    static void note_type_freed(size_type) {}
+    void note_held() {}
+#endif
+
+    // Profiling hooks, which compile to nothing without LINKED_LIST_PROFILING.
+    // A scope opened at the start of each operation records the hops made 
+    // until it closes
+#ifdef LINKED_LIST_PROFILING
+    class operation_scope
+    {
+      public:
+        explicit operation_scope(operation op);
+        ~operation_scope();
+
+        operation_scope(const operation_scope&) = delete;
+        operation_scope& operator=(const operation_scope&) = delete;
+
+      private:
+        operation op;
+        size_type start;
+        bool outermost;
+    };
+
+    struct profile_counters
+    {
+        std::atomic<size_type> calls;
+        std::atomic<size_type> hops;
+        std::atomic<size_type> histogram[hop_buckets];
+    };
+
+    // Hops made on this thread and the depth of nested operations
+    struct hop_counter
+    {
+        size_type hops;
+        size_type depth;
+    };
+
+    // Opened by a worker thread for the task it runs for an operation on
+    // another thread. The task's operations are nested in it, and its hops
+    // are added to total when it closes
+    class worker_scope
+    {
+      public:
+        explicit worker_scope(std::atomic<size_type>& total);
+        ~worker_scope();
+
+        worker_scope(const worker_scope&) = delete;
+        worker_scope& operator=(const worker_scope&) = delete;
+
+      private:
+        std::atomic<size_type>& total;
+        size_type start;
+    };
+
+    typedef std::atomic<size_type> worker_hops;
+
+    static profile_counters* profiles();
+    static hop_counter& thread_hops();
+    static void note_hops(size_type n = 1);
+#else
+    struct operation_scope
+    {
+        explicit operation_scope(operation) {}
+    };
+
+    typedef size_type worker_hops;
+
+    struct worker_scope
+    {
+        explicit worker_scope(worker_hops&) {}
+    };
+
+    static void note_hops(size_type = 1) {}
+#endif
+
+    // Swaps the pooled nodes
+    void swap_pool(self_type& origin);
+
+    // Swaps nodes, pools, and allocators regardless of the propagation traits
+    void swap_all(self_type& origin);
+
     // Throws a logic error exception if the node* is nullptr
     void throw_if_null(Node* node) const;
     // TODO make custom null exception that can print out useful information
@@ -239,6 +836,11 @@ class linear_linked_list
       public:
 
         typedef const_forward_iterator  self_type;
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                       value_type;
+        typedef std::ptrdiff_t          difference_type;
+        typedef const T*                pointer;
+        typedef const T&                reference;
 
         /* Constructors */
 
@@ -257,7 +859,7 @@ class linear_linked_list
         bool operator==(const self_type& rhs) const;
         bool operator!=(const self_type& rhs) const;
 
-        friend linear_linked_list<T>;
+        friend linear_linked_list<T, Allocator>;
       
       protected:
 
@@ -278,6 +880,8 @@ class linear_linked_list
 
         /* Type definitions */
         typedef forward_iterator    self_type;
+        typedef T*                  pointer;
+        typedef T&                  reference;
 
         forward_iterator(Node* ptr = nullptr) : const_forward_iterator(ptr) {}
 
@@ -288,6 +892,16 @@ class linear_linked_list
     };
 };
 
+#ifdef LINKED_LIST_HAS_PMR
+namespace pmr
+{
+    // Linear linked list whose nodes come from a std::pmr::memory_resource
+    template <typename T>
+    using linear_linked_list = 
+        ::linear_linked_list<T, std::pmr::polymorphic_allocator<T>>;
+}
+#endif
+
 #include "linear_linked_list.cpp"
 
 #endif //LINKED_LIST_H
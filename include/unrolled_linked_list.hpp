@@ -0,0 +1,325 @@
+/*
+
+ File: unrolled_linked_list.h
+
+ Brief: Unrolled Linked List is a heap allocated, singularly linked, sequence
+        container that stores up to K elements inline in each node. Iterating
+        small element types touches one node per K elements instead of one
+        node per element. The interface mirrors the linear_linked_list:
+        push/pop methods, sort, merge, split, remove_if, and forward iterators.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+#include <vector> // std::vector
+#include <memory> // std::allocator, std::allocator_traits
+#include <cstdint> // std::uint16_t
+#include <utility> // std::move
+#include <algorithm> // std::swap, std::sort, std::reverse
+#include <stdexcept> // std::logic_error
+#include <type_traits> // std::aligned_storage
+#include <initializer_list>  // std::initializer_list
+
+// By default each node holds as many elements as fit in about a cache line
+template <typename T,
+          std::size_t K = (sizeof(T) < 48) ? 48 / sizeof(T) : 1,
+          class Allocator = std::allocator<T>>
+class unrolled_linked_list
+{
+  public:
+
+    static_assert(K > 0 && K <= 0xFFFF, "K must be between 1 and 65535");
+
+    // forward declaration
+    class const_forward_iterator;
+    class forward_iterator;
+
+    /* Type definitions */
+    typedef T                      value_type;
+    typedef T*                     pointer;
+    typedef T&                     reference;
+    typedef const T&               const_reference;
+    typedef const T*               const_pointer;
+    typedef size_t                 size_type;
+    typedef Allocator              allocator_type;
+    typedef forward_iterator       iterator;
+    typedef const_forward_iterator const_iterator;
+    typedef unrolled_linked_list<T, K, Allocator>  self_type;
+
+    /****** CONSTRUCTORS ******/
+
+    // Default
+    unrolled_linked_list();
+
+    // Empty list that allocates its nodes with the provided allocator
+    explicit unrolled_linked_list(const allocator_type& alloc);
+
+    // Ranged based
+    template <class InputIterator>
+    unrolled_linked_list(InputIterator begin, InputIterator end,
+                         const allocator_type& alloc = allocator_type());
+
+    // Initializer List
+    explicit unrolled_linked_list(std::initializer_list<value_type> init,
+                                  const allocator_type& alloc = allocator_type());
+
+    // Copy Constructor
+    unrolled_linked_list(const self_type& origin);
+
+    // Move Constructor
+    unrolled_linked_list(self_type&& origin);
+
+    // Destructor
+    ~unrolled_linked_list();
+
+    /****** MODIFIERS ******/
+
+    // Adds an element to the front of the list
+    self_type& push_front(T&& data);
+    self_type& push_front(const_reference data);
+
+    // Adds an element to the back of the list
+    self_type& push_back(T&& data);
+    self_type& push_back(const_reference data);
+
+    // Removes the element at the front of the list
+    self_type& pop_front();
+
+    // Copies the front element onto the out_param and removes it
+    reference pop_front(reference out_param);
+    // NOTE: As with the linear_linked_list there is no pop_back method, the
+    // node before the tail can only be found by traversing the list
+
+    // Removes each element from the container
+    self_type& clear();
+
+    // Reverses the order of the nodes and of the elements within each node
+    self_type& reverse();
+
+    // Sorts the list, defaults to ascending order. Pointers to the elements
+    // are sorted, then the elements are moved through a contiguous buffer
+    // back into the same nodes in order. If comp throws, the list is unchanged
+    self_type& sort();
+
+    template <class Compare>
+    self_type& sort(Compare&& comp);
+
+    // Splits the list after pos and returns the split. Elements that share
+    // pos's node are moved into a new node, so this is O(K)
+    self_type split(const_iterator pos);
+
+    // Merges list into this list, both lists' allocators must compare equal.
+    // Equivalent elements keep this list's element first. If comp or an
+    // allocation throws, the elements merged so far are left at the front of
+    // this list and the rest stay in their own lists
+    self_type& merge(self_type& list);
+
+    template <class Compare>
+    self_type& merge(self_type& list, Compare&& comp);
+
+    // Removes the element after pos, shifting the rest of its node down
+    iterator erase_after(iterator pos);
+
+    // Removes all items matching target, returns number of items removed
+    int remove(const_reference target);
+
+    // Removes the all items fullfilling the predicate function. Remaining
+    // elements are packed into the front nodes and emptied nodes are freed
+    template <class Predicate>
+    int remove_if(Predicate&& pred);
+
+    /****** CAPACITY ******/
+
+    // returns true if the list is empty
+    bool empty() const;
+
+    // returns length of list by summing each node's count. O(n/K) operation.
+    size_type size() const;
+
+    /****** ELEMENT ACCESS ******/
+
+    // Returns a direct reference to the front element, throws if list is empty
+    reference front();
+    const_reference front() const;
+
+    // Returns a direct reference to the rear element, throws if list is empty
+    reference back();
+    const_reference back() const;
+
+    /****** ITERATORS ******/
+
+    iterator begin();
+    const_iterator begin() const;
+
+    iterator end();
+    const_iterator end() const;
+
+    // Counts the list then walks to the middle element. O(n) complexity.
+    iterator middle();
+    const_iterator middle() const;
+
+    /****** ALLOCATOR ******/
+
+    // Returns a copy of the allocator used to construct the nodes
+    allocator_type get_allocator() const;
+
+    /****** COMPARISON OPERATORS ******/
+
+    // Compares sizes, then comapres each element of the list for equality
+    bool operator==(const self_type& rhs) const;
+
+    // returns the logical NOT of the equality comparison
+    bool operator!=(const self_type& rhs) const;
+
+    /****** COPY-ASSIGNMENT AND SWAP ******/
+
+    // Swaps pointers to each other's resources. effectively reassigning
+    // ownership. Allocators are swapped only if propagate_on_container_swap
+    void swap(self_type& origin);
+
+    // creates a copy of the origin, then swaps ownership with the copy. The
+    // origin's allocator is adopted if propagate_on_container_copy_assignment
+    self_type& operator=(const self_type& origin);
+
+    // Takes ownership of the origin's nodes
+    self_type& operator=(self_type&& origin);
+
+  private:
+
+    typedef std::uint16_t index_type;
+
+    /*
+    @struct: Node
+
+    @brief: Node stores up to K elements in an inline array. The elements in
+            use occupy the contiguous range [first, last), which lets elements
+            be added at either end of the range without shifting.
+    */
+    struct Node
+    {
+        Node(Node* next = nullptr, index_type first = 0)
+            : next(next), first(first), last(first) {}
+
+        pointer elements() { return reinterpret_cast<pointer>(&storage); }
+
+        Node* next;
+
+        index_type first;
+        index_type last;
+
+        typename std::aligned_storage<sizeof(T) * K, alignof(T)>::type storage;
+    };
+
+    typedef typename std::allocator_traits<Allocator>::template
+            rebind_alloc<Node>                  node_allocator;
+    typedef std::allocator_traits<node_allocator> node_traits;
+
+    Node* head;
+    Node* tail;
+
+    node_allocator alloc;
+
+    /* Subroutines */
+
+    // Constructs an element in the first or last free slot, adding a node
+    // if the end node is full
+    template <class... Args>
+    void construct_front(Args&&... args);
+
+    template <class... Args>
+    void construct_back(Args&&... args);
+
+    // Allocates an empty node whose element range starts at first
+    Node* create_node(Node* next, index_type first);
+
+    // Destroys the node's elements then frees it
+    void destroy_node(Node* node);
+
+    // Frees a node that holds no elements
+    void deallocate_node(Node* node);
+
+    // Swaps nodes and allocators regardless of the propagation traits
+    void swap_all(self_type& origin);
+
+    // Throws a logic error exception if the node* is nullptr
+    void throw_if_null(Node* node) const;
+
+  public:
+
+    /*
+    @class: const_forward_iterator
+
+    @brief: The const_forward_iterator is a read-only abstraction of a node
+            pointer and an index into the node's elements. This iterator type
+            does not support decrementation or random access
+    */
+    class const_forward_iterator
+    {
+      public:
+
+        typedef const_forward_iterator  self_type;
+
+        /* Constructors */
+
+        // default constructor points the iterator to nullptr
+        const_forward_iterator(Node* ptr = nullptr)
+            : node(ptr), index(ptr ? ptr->first : 0) {}
+
+        /* Operator Overloads */
+
+        self_type& operator++(); // Prefix ++
+        self_type operator++(int); // Postfix ++
+
+        const_reference operator*() const;
+        const_pointer operator->() const;
+
+        // Iterators are equal if they point to the same element
+        bool operator==(const self_type& rhs) const;
+        bool operator!=(const self_type& rhs) const;
+
+        friend unrolled_linked_list<T, K, Allocator>;
+
+      protected:
+
+        Node* node;
+        size_type index;
+    };
+
+    /*
+    @class: forward_iterator
+
+    @brief: The forward_iterator is a read/write abstraction of the element.
+            The forward_iterator inherits all methods from the
+            const_forward_iterator but overrides the reference operators
+            to allow the client to mutate data
+    */
+    class forward_iterator : public const_forward_iterator
+    {
+      public:
+
+        /* Type definitions */
+        typedef forward_iterator    self_type;
+
+        forward_iterator(Node* ptr = nullptr) : const_forward_iterator(ptr) {}
+
+        reference operator*();
+
+        pointer operator->();
+
+    };
+};
+
+#include "unrolled_linked_list.cpp"
+
+#endif //UNROLLED_LINKED_LIST_H
+
@@ -7,7 +7,9 @@
 
 -- WORKSPACE CONFIGURATION --
 workspace "LinkedList"
-    configurations { "debug", "release" }
+    -- The *17 configurations build with C++17, enabling the std::pmr aliases.
+    -- The profile configuration is an optimized build that counts node hops
+    configurations { "debug", "release", "profile", "debug17", "release17" }
 
     if _ACTION == "clean" then
         os.rmdir("bin/")
@@ -26,18 +28,33 @@ workspace "LinkedList"
     flags "FatalWarnings"
     warnings "Extra"
 
+    -- Debug builds keep node statistics, release builds compile them away
     filter "configurations:debug*"   
-        defines { "DEBUG", "MOCKING_ENABLED" } 
+        defines { "DEBUG", "MOCKING_ENABLED", "LINKED_LIST_STATISTICS" } 
         symbols "On"
 
     filter "configurations:release*" 
         defines { "NDEBUG" } 
         optimize "On"
 
+    -- See linear_linked_list::profile for the hops counted per operation
+    filter "configurations:profile"
+        defines { "NDEBUG", "LINKED_LIST_PROFILING" }
+        optimize "On"
+        symbols "On"
+
     filter "toolset:gcc"
         buildoptions { 
-            "-Wall", "-Wextra", "-Werror", "-std=c++11"
+            "-Wall", "-Wextra", "-Werror", "-pthread"
         }
+        -- parallel_sort and the thread cache tests use std::thread
+        linkoptions { "-pthread" }
+
+    filter { "toolset:gcc", "configurations:not *17" }
+        buildoptions { "-std=c++11" }
+
+    filter { "toolset:gcc", "configurations:*17" }
+        buildoptions { "-std=c++17" }
 
     filter {} -- close filter
 
@@ -83,5 +100,24 @@ project "Tests"
 
     postbuildcommands ".././bin/tests/run_tests"
 
+project "Benchmarks"
+    kind "ConsoleApp"
+    language "C++"
+    links "LinkedList"
+    targetdir "bin/benchmarks/"
+    targetname "run_benchmarks_%{cfg.shortname}"
+
+    local include   = "include/"
+    local bench_src = "benchmarks/"
+    local bench_inc = "third_party/"
+
+    files (bench_src .. "**.cpp")
+
+    includedirs { bench_inc, include, "src/" }
+
+    -- Benchmarks are only meaningful with optimizations, so they are run 
+    -- manually from bin/benchmarks/ rather than after every build. Pass
+    -- -r json to write the results as JSON
+
     filter {} -- close filter
 
@@ -0,0 +1,900 @@
+/*
+
+ File: compact_linked_list.cpp
+
+ Brief: Implementation file for the compact_linked_list data structure
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef COMPACT_LINKED_LIST_CPP
+#define COMPACT_LINKED_LIST_CPP
+
+#include "compact_linked_list.hpp"
+
+template <typename T, class Allocator>
+const typename compact_linked_list<T, Allocator>::index_type
+compact_linked_list<T, Allocator>::npos;
+
+/****** CONSTRUCTORS ******/
+
+// default constructor
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>::compact_linked_list()
+    : slots(nullptr), head(npos), tail(npos), free_list(npos),
+      used(0), slot_count(0), count(0), alloc() {}
+
+// allocator constructor
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>::compact_linked_list(const allocator_type& alloc)
+    : slots(nullptr), head(npos), tail(npos), free_list(npos),
+      used(0), slot_count(0), count(0), alloc(alloc) {}
+
+// ranged based constructor
+template <typename T, class Allocator>
+template <class InputIterator>
+compact_linked_list<T, Allocator>::compact_linked_list(InputIterator begin,
+                                                       InputIterator end,
+                                                       const allocator_type& alloc)
+    : compact_linked_list(alloc)
+{
+    for(; begin != end; ++begin)
+    {
+        push_back(*begin);
+    }
+}
+
+// Initializer List
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>::compact_linked_list(std::initializer_list<value_type> init,
+                                                       const allocator_type& alloc)
+    : compact_linked_list(alloc)
+{
+    reserve(init.size());
+
+    for (const_reference element : init)
+    {
+        push_back(element);
+    }
+}
+
+// Copy constructor
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>::compact_linked_list(const self_type& origin)
+    : compact_linked_list(
+        std::allocator_traits<Allocator>::select_on_container_copy_construction(
+            origin.get_allocator()))
+{
+    reserve(origin.size());
+
+    for (const_reference element : origin)
+    {
+        push_back(element);
+    }
+}
+
+// Move constructor
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>::compact_linked_list(self_type&& origin)
+    : compact_linked_list(origin.get_allocator())
+{
+    swap_all(origin);
+}
+
+// Destructor
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>::~compact_linked_list()
+{
+    clear();
+
+    if (slots != nullptr)
+    {
+        node_traits::deallocate(alloc, slots, slot_count);
+    }
+}
+
+/****** MODIFIERS ******/
+
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>&
+compact_linked_list<T, Allocator>::push_front(const_reference data)
+{
+    index_type slot = create_slot(npos, data);
+
+    // slots are renumbered if the buffer grows, read head after creation
+    slots[slot].next = head;
+    head = slot;
+
+    if (tail == npos)
+    {
+        tail = head;
+    }
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>&
+compact_linked_list<T, Allocator>::push_front(T&& data)
+{
+    index_type slot = create_slot(npos, std::forward<T>(data));
+
+    // slots are renumbered if the buffer grows, read head after creation
+    slots[slot].next = head;
+    head = slot;
+
+    if (tail == npos)
+    {
+        tail = head;
+    }
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>&
+compact_linked_list<T, Allocator>::push_back(const_reference data)
+{
+    index_type slot = create_slot(npos, data);
+
+    // slots are renumbered if the buffer grows, read tail after creation
+    (tail == npos ? head : slots[tail].next) = slot;
+    tail = slot;
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>&
+compact_linked_list<T, Allocator>::push_back(T&& data)
+{
+    index_type slot = create_slot(npos, std::forward<T>(data));
+
+    // slots are renumbered if the buffer grows, read tail after creation
+    (tail == npos ? head : slots[tail].next) = slot;
+    tail = slot;
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>&
+compact_linked_list<T, Allocator>::pop_front()
+{
+    if (empty())
+    {
+        return *this;
+    }
+
+    index_type temp = slots[head].next;
+
+    // Edge case, there is only one element in the list
+    if (tail == head)
+    {
+        tail = temp;
+    }
+
+    release_slot(head);
+
+    head = temp;
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+T& compact_linked_list<T, Allocator>::pop_front(reference out_param)
+{
+    if(!empty())
+    {
+        out_param = std::move(*slots[head].data());
+
+        pop_front();
+    }
+
+    return out_param;
+}
+
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>&
+compact_linked_list<T, Allocator>::clear()
+{
+    for (index_type slot = head; slot != npos; slot = slots[slot].next)
+    {
+        node_traits::destroy(alloc, slots[slot].data());
+    }
+
+    // Every slot is unused again, so there is no need for a free list
+    head = tail = free_list = npos;
+    used = 0;
+    count = 0;
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>&
+compact_linked_list<T, Allocator>::reverse()
+{
+    index_type prev = npos;
+    index_type current = head;
+
+    while (current != npos)
+    {
+        index_type next = slots[current].next;
+        slots[current].next = prev;
+        prev = current;
+        current = next;
+    }
+
+    std::swap(head, tail);
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>&
+compact_linked_list<T, Allocator>::sort()
+{
+    return sort([](const T& lhs, const T& rhs){ return lhs < rhs; });
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+compact_linked_list<T, Allocator>&
+compact_linked_list<T, Allocator>::sort(Compare&& comp)
+{
+    if (count < 2)
+    {
+        return *this;
+    }
+
+    typedef typename std::allocator_traits<Allocator>::template
+            rebind_alloc<index_type> index_allocator;
+
+    std::vector<index_type, index_allocator> order((index_allocator(alloc)));
+    order.reserve(count);
+
+    for (index_type slot = head; slot != npos; slot = slots[slot].next)
+    {
+        order.push_back(slot);
+    }
+
+    Node* nodes = slots;
+    std::sort(order.begin(), order.end(), [&](index_type lhs, index_type rhs)
+    {
+        return comp(*nodes[lhs].data(), *nodes[rhs].data());
+    });
+
+    // Relink the slots in sorted order
+    for (size_type i = 0; i + 1 < order.size(); ++i)
+    {
+        slots[order[i]].next = order[i + 1];
+    }
+
+    head = order.front();
+    tail = order.back();
+    slots[tail].next = npos;
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>&
+compact_linked_list<T, Allocator>::merge(self_type& list)
+{
+    return merge(list, [](const T& lhs, const T& rhs){ return lhs < rhs; });
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+compact_linked_list<T, Allocator>&
+compact_linked_list<T, Allocator>::merge(self_type& list, Compare&& comp)
+{
+    if(&list == this || list.empty())
+    {
+        return *this;
+    }
+
+    reserve(count + list.count);
+
+    // Move list's elements into this buffer as a separate chain of slots
+    index_type other_head = npos;
+    index_type other_tail = npos;
+
+    try
+    {
+        for (reference element : list)
+        {
+            index_type slot = create_slot(npos, std::move(element));
+            (other_tail == npos ? other_head : slots[other_tail].next) = slot;
+            other_tail = slot;
+        }
+    }
+    catch (...)
+    {
+        // The moved elements belong to neither list yet, give their slots
+        // back. list keeps its elements, the moved ones are moved-from
+        while (other_head != npos)
+        {
+            index_type next = slots[other_head].next;
+            release_slot(other_head);
+            other_head = next;
+        }
+        throw;
+    }
+    list.clear();
+
+    index_type self = head;
+    index_type other = other_head;
+
+    // link always points at the next index to be filled in
+    index_type* link = &head;
+
+    try
+    {
+        while (self != npos && other != npos)
+        {
+            if (comp(*slots[self].data(), *slots[other].data()))
+            {
+                *link = self;
+                self = slots[self].next;
+            }
+            else
+            {
+                *link = other;
+                other = slots[other].next;
+            }
+            link = &slots[*link].next;
+        }
+    }
+    catch (...)
+    {
+        // Keep both remainders linked, the list is left unsorted but whole
+        *link = self;
+        slots[tail].next = other;
+        tail = other_tail;
+        throw;
+    }
+
+    // One chain is exhausted, append the remainder of the non-empty chain
+    if (self != npos)
+    {
+        *link = self;
+    }
+    else
+    {
+        *link = other;
+        tail = other_tail;
+    }
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::iterator
+compact_linked_list<T, Allocator>::erase_after(iterator pos)
+{
+    if(!empty() && pos.index != npos && pos.index != tail)
+    {
+        index_type temp = slots[pos.index].next;
+        slots[pos.index].next = slots[temp].next;
+
+        if (temp == tail)
+        {
+            tail = pos.index;
+        }
+
+        release_slot(temp);
+    }
+    return pos;
+}
+
+template <typename T, class Allocator>
+int compact_linked_list<T, Allocator>::remove(const_reference target)
+{
+    // lambda catches target and compares it to each element in the list
+    return remove_if([&target](T& sample){ return target == sample; });
+}
+
+template <typename T, class Allocator>
+template <class Predicate>
+int compact_linked_list<T, Allocator>::remove_if(Predicate&& pred)
+{
+    int removed = 0;
+    index_type prev = npos;
+
+    // link always points at the index of the slot under test
+    index_type* link = &head;
+
+    while (*link != npos)
+    {
+        index_type slot = *link;
+
+        // Predicate fulfilled, unlink and remove this element
+        if (pred(*slots[slot].data()))
+        {
+            if (tail == slot)
+            {
+                tail = prev;
+            }
+
+            *link = slots[slot].next;
+
+            release_slot(slot);
+
+            ++removed;
+        }
+        else
+        {
+            prev = slot;
+            link = &slots[slot].next;
+        }
+    }
+
+    return removed;
+}
+
+/****** CAPACITY ******/
+
+template <typename T, class Allocator>
+bool compact_linked_list<T, Allocator>::empty() const
+{
+    return head == npos;
+}
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::size_type
+compact_linked_list<T, Allocator>::size() const
+{
+    return count;
+}
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::size_type
+compact_linked_list<T, Allocator>::capacity() const
+{
+    return slot_count;
+}
+
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>&
+compact_linked_list<T, Allocator>::reserve(size_type n)
+{
+    if (n >= npos)
+    {
+        throw std::length_error("compact_linked_list cannot index n elements");
+    }
+
+    if (n > slot_count)
+    {
+        relocate(n);
+    }
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+compact_linked_list<T, Allocator>&
+compact_linked_list<T, Allocator>::shrink_to_fit()
+{
+    relocate(count);
+
+    return *this;
+}
+
+/****** ELEMENT ACCESS ******/
+
+template <typename T, class Allocator>
+T& compact_linked_list<T, Allocator>::front()
+{
+    throw_if_null(head);
+
+    return *slots[head].data();
+}
+
+template <typename T, class Allocator>
+const T& compact_linked_list<T, Allocator>::front() const
+{
+    throw_if_null(head);
+
+    return *slots[head].data();
+}
+
+template <typename T, class Allocator>
+T& compact_linked_list<T, Allocator>::back()
+{
+    throw_if_null(tail);
+
+    return *slots[tail].data();
+}
+
+template <typename T, class Allocator>
+const T& compact_linked_list<T, Allocator>::back() const
+{
+    throw_if_null(tail);
+
+    return *slots[tail].data();
+}
+
+/****** ITERATORS ******/
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::iterator
+compact_linked_list<T, Allocator>::begin()
+{
+    return iterator(slots, head);
+}
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::const_iterator
+compact_linked_list<T, Allocator>::begin() const
+{
+    return const_iterator(slots, head);
+}
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::iterator
+compact_linked_list<T, Allocator>::end()
+{
+    return iterator(slots, npos);
+}
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::const_iterator
+compact_linked_list<T, Allocator>::end() const
+{
+    return const_iterator(slots, npos);
+}
+
+/****** ALLOCATOR ******/
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::allocator_type
+compact_linked_list<T, Allocator>::get_allocator() const
+{
+    return allocator_type(alloc);
+}
+
+/****** COMPARISON OPERATORS ******/
+
+template <typename T, class Allocator>
+bool compact_linked_list<T, Allocator>::operator==(const self_type& rhs) const
+{
+    // Compare sizes first
+    if (rhs.size() != size())
+    {
+        return false;
+    }
+
+    const_iterator left = begin();
+    const_iterator right = rhs.begin();
+
+    while(left != end() && right != rhs.end())
+    {
+        // If any element does not match then return false
+        if (*(left++) != *(right++))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T, class Allocator>
+bool compact_linked_list<T, Allocator>::operator!=(const self_type& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::self_type&
+compact_linked_list<T, Allocator>::operator=(const self_type& origin)
+{
+    if (this == &origin)
+    {
+        return *this;
+    }
+
+    self_type copy(node_traits::propagate_on_container_copy_assignment::value
+                   ? origin.get_allocator() : get_allocator());
+
+    copy.reserve(origin.size());
+    for (const_reference element : origin)
+    {
+        copy.push_back(element);
+    }
+
+    // Swap ownership of resources with the copy
+    swap_all(copy);
+
+    // As the copy goes out of scope it destructs with the old data
+    return *this;
+}
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::self_type&
+compact_linked_list<T, Allocator>::operator=(self_type&& origin)
+{
+    if (this == &origin)
+    {
+        return *this;
+    }
+
+    if (node_traits::propagate_on_container_move_assignment::value)
+    {
+        swap_all(origin);
+    }
+    else if (alloc == origin.alloc)
+    {
+        swap(origin);
+    }
+    else
+    {
+        // The buffer cannot be freed by a different allocator, move each element
+        clear();
+        for (reference element : origin)
+        {
+            push_back(std::move(element));
+        }
+    }
+
+    origin.clear();
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+void compact_linked_list<T, Allocator>::swap(self_type& origin)
+{
+    using std::swap;
+
+    if (node_traits::propagate_on_container_swap::value)
+    {
+        swap(alloc, origin.alloc);
+    }
+
+    // Swaps buffers, reassigns ownership
+    swap(slots, origin.slots);
+    swap(head, origin.head);
+    swap(tail, origin.tail);
+    swap(free_list, origin.free_list);
+    swap(used, origin.used);
+    swap(slot_count, origin.slot_count);
+    swap(count, origin.count);
+    return;
+}
+
+template <typename T, class Allocator>
+void compact_linked_list<T, Allocator>::swap_all(self_type& origin)
+{
+    using std::swap;
+
+    swap(alloc, origin.alloc);
+    swap(slots, origin.slots);
+    swap(head, origin.head);
+    swap(tail, origin.tail);
+    swap(free_list, origin.free_list);
+    swap(used, origin.used);
+    swap(slot_count, origin.slot_count);
+    swap(count, origin.count);
+    return;
+}
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::index_type
+compact_linked_list<T, Allocator>::acquire_slot()
+{
+    if (free_list != npos)
+    {
+        index_type slot = free_list;
+        free_list = slots[slot].next;
+        return slot;
+    }
+
+    if (used == slot_count)
+    {
+        // npos marks the end of a chain, so it can never be a slot index
+        if (slot_count == npos)
+        {
+            throw std::length_error("compact_linked_list is full");
+        }
+
+        size_type doubled = (slot_count == 0) ? 8 : size_type(slot_count) * 2;
+        relocate(doubled < npos ? doubled : size_type(npos));
+    }
+
+    return used++;
+}
+
+template <typename T, class Allocator>
+void compact_linked_list<T, Allocator>::release_slot(index_type slot)
+{
+    node_traits::destroy(alloc, slots[slot].data());
+
+    slots[slot].next = free_list;
+    free_list = slot;
+
+    --count;
+}
+
+template <typename T, class Allocator>
+template <class... Args>
+typename compact_linked_list<T, Allocator>::index_type
+compact_linked_list<T, Allocator>::create_slot(index_type next, Args&&... args)
+{
+    // args may refer to an element that growing the buffer would move, so
+    // build the value before growing
+    if (free_list == npos && used == slot_count)
+    {
+        value_type value(std::forward<Args>(args)...);
+
+        return construct_slot(acquire_slot(), next, std::move(value));
+    }
+
+    return construct_slot(acquire_slot(), next, std::forward<Args>(args)...);
+}
+
+template <typename T, class Allocator>
+template <class... Args>
+typename compact_linked_list<T, Allocator>::index_type
+compact_linked_list<T, Allocator>::construct_slot(index_type slot, index_type next,
+                                                  Args&&... args)
+{
+    try
+    {
+        node_traits::construct(alloc, slots[slot].data(), std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        // Construction failed, return the slot before rethrowing
+        slots[slot].next = free_list;
+        free_list = slot;
+        throw;
+    }
+
+    slots[slot].next = next;
+    ++count;
+
+    return slot;
+}
+
+template <typename T, class Allocator>
+void compact_linked_list<T, Allocator>::relocate(size_type new_capacity)
+{
+    Node* buffer = nullptr;
+
+    if (new_capacity > 0)
+    {
+        buffer = node_traits::allocate(alloc, new_capacity);
+    }
+
+    // Move the elements into the new buffer in list order
+    index_type moved = 0;
+    try
+    {
+        for (index_type slot = head; slot != npos; slot = slots[slot].next)
+        {
+            node_traits::construct(alloc, buffer[moved].data(),
+                                   std::move_if_noexcept(*slots[slot].data()));
+            buffer[moved].next = moved + 1;
+            ++moved;
+        }
+    }
+    catch (...)
+    {
+        for (index_type i = 0; i < moved; ++i)
+        {
+            node_traits::destroy(alloc, buffer[i].data());
+        }
+        node_traits::deallocate(alloc, buffer, new_capacity);
+        throw;
+    }
+
+    size_type live = count;
+    clear();
+
+    if (slots != nullptr)
+    {
+        node_traits::deallocate(alloc, slots, slot_count);
+    }
+
+    slots = buffer;
+    slot_count = static_cast<index_type>(new_capacity);
+    used = moved;
+    count = live;
+
+    head = (moved == 0) ? npos : 0;
+    tail = (moved == 0) ? npos : moved - 1;
+
+    if (tail != npos)
+    {
+        slots[tail].next = npos;
+    }
+}
+
+template <typename T, class Allocator>
+void compact_linked_list<T, Allocator>::throw_if_null(index_type slot) const
+{
+    if(slot != npos)
+    {
+        return;
+    }
+
+    throw std::logic_error("Element access fail, null pointer");
+}
+
+/*******************************************************************************
+ITERATOR CLASS
+*******************************************************************************/
+
+/* Operator Overloads */
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::const_iterator&
+compact_linked_list<T, Allocator>::const_iterator::operator++()
+{
+    // reassign index member to refer to the next element in the container
+    index = slots[index].next;
+    return *this;
+}
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::const_iterator
+compact_linked_list<T, Allocator>::const_iterator::operator++(int)
+{
+    // Create a copy to satisfy postfix incrementation requirements
+    self_type copy = self_type(*this);
+    ++(*this);
+    return copy;
+}
+
+template <typename T, class Allocator>
+bool compact_linked_list<T, Allocator>::const_iterator::operator==(const self_type& rhs) const
+{
+    // Iterators are equal if they refer to the same slot
+    return index == rhs.index;
+}
+
+template <typename T, class Allocator>
+bool compact_linked_list<T, Allocator>::const_iterator::operator!=(const self_type& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::const_reference
+compact_linked_list<T, Allocator>::const_iterator::operator*() const
+{
+    return *slots[index].data();
+}
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::const_pointer
+compact_linked_list<T, Allocator>::const_iterator::operator->() const
+{
+    return slots[index].data();
+}
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::reference
+compact_linked_list<T, Allocator>::iterator::operator*()
+{
+    return *this->slots[this->index].data();
+}
+
+template <typename T, class Allocator>
+typename compact_linked_list<T, Allocator>::pointer
+compact_linked_list<T, Allocator>::iterator::operator->()
+{
+    return this->slots[this->index].data();
+}
+
+#endif //COMPACT_LINKED_LIST_CPP
+
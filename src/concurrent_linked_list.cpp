@@ -0,0 +1,329 @@
+/*
+
+ File: concurrent_linked_list.cpp
+
+ Brief: Implementation file for the concurrent_linked_list data structure
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef CONCURRENT_LINKED_LIST_CPP
+#define CONCURRENT_LINKED_LIST_CPP
+
+#include "concurrent_linked_list.hpp"
+
+/****** CONSTRUCTORS ******/
+
+// default constructor
+template <typename T, class Allocator>
+concurrent_linked_list<T, Allocator>::concurrent_linked_list()
+    : concurrent_linked_list(allocator_type()) {}
+
+// allocator constructor
+template <typename T, class Allocator>
+concurrent_linked_list<T, Allocator>::concurrent_linked_list(const allocator_type& alloc)
+    : head(), count(0), alloc(alloc) {}
+
+// Destructor
+template <typename T, class Allocator>
+concurrent_linked_list<T, Allocator>::~concurrent_linked_list()
+{
+    destroy_nodes(head.next);
+}
+
+/****** MODIFIERS ******/
+
+template <typename T, class Allocator>
+concurrent_linked_list<T, Allocator>&
+concurrent_linked_list<T, Allocator>::push_front(const_reference data)
+{
+    return emplace_front(data);
+}
+
+template <typename T, class Allocator>
+concurrent_linked_list<T, Allocator>&
+concurrent_linked_list<T, Allocator>::push_front(T&& data)
+{
+    return emplace_front(std::move(data));
+}
+
+template <typename T, class Allocator>
+template <class... Args>
+concurrent_linked_list<T, Allocator>&
+concurrent_linked_list<T, Allocator>::emplace_front(Args&&... args)
+{
+    // The element is constructed before any lock is taken
+    Node* node = create_node(std::forward<Args>(args)...);
+
+    node_lock front(head.lock);
+    node->next = head.next;
+    head.next = node;
+    ++count;
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+bool concurrent_linked_list<T, Allocator>::insert_after(const_reference target,
+                                                        const_reference data)
+{
+    return emplace_after(target, data);
+}
+
+template <typename T, class Allocator>
+bool concurrent_linked_list<T, Allocator>::insert_after(const_reference target, T&& data)
+{
+    return emplace_after(target, std::move(data));
+}
+
+template <typename T, class Allocator>
+template <class... Args>
+bool concurrent_linked_list<T, Allocator>::emplace_after(const_reference target,
+                                                         Args&&... args)
+{
+    Node* node = create_node(std::forward<Args>(args)...);
+    Node* pos = nullptr;
+
+    try
+    {
+        node_lock locked = lock_first([&target](const T& sample){ return target == sample; }, pos);
+        if (pos != nullptr)
+        {
+            // Holding pos is enough, every thread that links after it holds it
+            node->next = pos->next;
+            pos->next = node;
+            ++count;
+            return true;
+        }
+    }
+    catch (...)
+    {
+        destroy_nodes(node);
+        throw;
+    }
+
+    destroy_nodes(node);
+    return false;
+}
+
+template <typename T, class Allocator>
+bool concurrent_linked_list<T, Allocator>::try_pop_front(reference out_param)
+{
+    Node* front = nullptr;
+    {
+        node_lock head_lock(head.lock);
+        if (head.next == nullptr)
+        {
+            return false;
+        }
+
+        // A thread past the front node still holds it, wait for it to leave
+        front = head.next;
+        node_lock front_lock(front->lock);
+
+        out_param = std::move(front->data);
+        head.next = front->next;
+        --count;
+    }
+
+    // Reaching the node needs the head's lock, no other thread can hold it
+    front->next = nullptr;
+    destroy_nodes(front);
+    return true;
+}
+
+template <typename T, class Allocator>
+bool concurrent_linked_list<T, Allocator>::erase_after(const_reference target)
+{
+    Node* pos = nullptr;
+    Node* erased = nullptr;
+    {
+        node_lock pos_lock = lock_first([&target](const T& sample){ return target == sample; }, pos);
+        if (pos == nullptr || pos->next == nullptr)
+        {
+            return false;
+        }
+
+        erased = pos->next;
+        node_lock erased_lock(erased->lock);
+
+        pos->next = erased->next;
+        --count;
+    }
+
+    erased->next = nullptr;
+    destroy_nodes(erased);
+    return true;
+}
+
+template <typename T, class Allocator>
+int concurrent_linked_list<T, Allocator>::remove(const_reference target)
+{
+    // lambda catches target and compares it to each element in the list
+    return remove_if([&target](const T& sample){ return target == sample; });
+}
+
+template <typename T, class Allocator>
+template <class Predicate>
+int concurrent_linked_list<T, Allocator>::remove_if(Predicate&& pred)
+{
+    // Removed nodes are chained here and destroyed once every lock is free
+    Node* removed = nullptr;
+    int removed_count = 0;
+
+    try
+    {
+        Link* prev = &head;
+        node_lock prev_lock(head.lock);
+
+        while (prev->next != nullptr)
+        {
+            Node* current = prev->next;
+            node_lock current_lock(current->lock);
+
+            if (pred(current->data))
+            {
+                prev->next = current->next;
+                current->next = removed;
+                removed = current;
+                ++removed_count;
+                --count;
+
+                // prev is still held, it is compared with its new next
+                continue;
+            }
+
+            // Hand over hand, current is held before prev is released
+            prev_lock = std::move(current_lock);
+            prev = current;
+        }
+    }
+    catch (...)
+    {
+        destroy_nodes(removed);
+        throw;
+    }
+
+    destroy_nodes(removed);
+    return removed_count;
+}
+
+/****** LOOKUP ******/
+
+template <typename T, class Allocator>
+bool concurrent_linked_list<T, Allocator>::find(const_reference target) const
+{
+    Node* found = nullptr;
+    lock_first([&target](const T& sample){ return target == sample; }, found);
+    return found != nullptr;
+}
+
+template <typename T, class Allocator>
+template <class Predicate>
+bool concurrent_linked_list<T, Allocator>::find_if(Predicate&& pred,
+                                                   reference out_param) const
+{
+    Node* found = nullptr;
+    node_lock locked = lock_first(std::forward<Predicate>(pred), found);
+    if (found == nullptr)
+    {
+        return false;
+    }
+
+    // Copied while the node is held, it cannot be erased mid copy
+    out_param = found->data;
+    return true;
+}
+
+/****** CAPACITY ******/
+
+template <typename T, class Allocator>
+bool concurrent_linked_list<T, Allocator>::empty() const
+{
+    return count.load(std::memory_order_relaxed) == 0;
+}
+
+template <typename T, class Allocator>
+typename concurrent_linked_list<T, Allocator>::size_type
+concurrent_linked_list<T, Allocator>::size() const
+{
+    return count.load(std::memory_order_relaxed);
+}
+
+/****** ALLOCATOR ******/
+
+template <typename T, class Allocator>
+typename concurrent_linked_list<T, Allocator>::allocator_type
+concurrent_linked_list<T, Allocator>::get_allocator() const
+{
+    return allocator_type(alloc);
+}
+
+/****** NODE MANAGEMENT ******/
+
+template <typename T, class Allocator>
+template <class... Args>
+typename concurrent_linked_list<T, Allocator>::Node*
+concurrent_linked_list<T, Allocator>::create_node(Args&&... args)
+{
+    Node* node = node_traits::allocate(alloc, 1);
+
+    try
+    {
+        node_traits::construct(alloc, node, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        node_traits::deallocate(alloc, node, 1);
+        throw;
+    }
+
+    return node;
+}
+
+template <typename T, class Allocator>
+void concurrent_linked_list<T, Allocator>::destroy_nodes(Node* node)
+{
+    while (node != nullptr)
+    {
+        Node* next = node->next;
+
+        node_traits::destroy(alloc, node);
+        node_traits::deallocate(alloc, node, 1);
+        node = next;
+    }
+}
+
+template <typename T, class Allocator>
+template <class Predicate>
+typename concurrent_linked_list<T, Allocator>::node_lock
+concurrent_linked_list<T, Allocator>::lock_first(Predicate&& pred, Node*& found) const
+{
+    Link* prev = &head;
+    node_lock prev_lock(head.lock);
+
+    for (Node* current = prev->next; current != nullptr; current = prev->next)
+    {
+        // Hand over hand, current is held before prev is released
+        prev_lock = node_lock(current->lock);
+        prev = current;
+
+        if (pred(current->data))
+        {
+            found = current;
+            return prev_lock;
+        }
+    }
+
+    found = nullptr;
+    return node_lock();
+}
+
+#endif //CONCURRENT_LINKED_LIST_CPP
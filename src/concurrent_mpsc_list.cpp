@@ -0,0 +1,179 @@
+/*
+
+ File: concurrent_mpsc_list.cpp
+
+ Brief: Implementation file for the concurrent_mpsc_list data structure
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef CONCURRENT_MPSC_LIST_CPP
+#define CONCURRENT_MPSC_LIST_CPP
+
+#include "concurrent_mpsc_list.hpp"
+
+template <typename T, class Allocator>
+const typename concurrent_mpsc_list<T, Allocator>::size_type
+concurrent_mpsc_list<T, Allocator>::cache_line;
+
+/****** CONSTRUCTORS ******/
+
+// default constructor
+template <typename T, class Allocator>
+concurrent_mpsc_list<T, Allocator>::concurrent_mpsc_list()
+    : concurrent_mpsc_list(allocator_type()) {}
+
+// allocator constructor
+template <typename T, class Allocator>
+concurrent_mpsc_list<T, Allocator>::concurrent_mpsc_list(const allocator_type& alloc)
+    : head(nullptr), tail(nullptr), alloc(alloc)
+{
+    // The list starts as a lone sentinel, both ends point at it
+    head = create_node();
+    tail.store(head, std::memory_order_relaxed);
+}
+
+// Destructor
+template <typename T, class Allocator>
+concurrent_mpsc_list<T, Allocator>::~concurrent_mpsc_list()
+{
+    Node* next = head->next.load(std::memory_order_acquire);
+    destroy_node(head);
+
+    // Every node after the sentinel holds an element
+    while (next != nullptr)
+    {
+        Node* node = next;
+        next = node->next.load(std::memory_order_acquire);
+
+        node_traits::destroy(alloc, node->element());
+        destroy_node(node);
+    }
+}
+
+/****** MODIFIERS ******/
+
+template <typename T, class Allocator>
+concurrent_mpsc_list<T, Allocator>&
+concurrent_mpsc_list<T, Allocator>::push_back(const_reference data)
+{
+    return emplace_back(data);
+}
+
+template <typename T, class Allocator>
+concurrent_mpsc_list<T, Allocator>&
+concurrent_mpsc_list<T, Allocator>::push_back(T&& data)
+{
+    return emplace_back(std::move(data));
+}
+
+template <typename T, class Allocator>
+template <class... Args>
+concurrent_mpsc_list<T, Allocator>&
+concurrent_mpsc_list<T, Allocator>::emplace_back(Args&&... args)
+{
+    Node* node = create_node();
+
+    try
+    {
+        node_traits::construct(alloc, node->element(), std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        // Construction failed, the node was never visible to another thread
+        destroy_node(node);
+        throw;
+    }
+
+    link_back(node);
+    return *this;
+}
+
+template <typename T, class Allocator>
+bool concurrent_mpsc_list<T, Allocator>::try_pop_front(reference out_param)
+{
+    // Acquire pairs with the producer's release, the element is constructed
+    Node* front = head->next.load(std::memory_order_acquire);
+
+    if (front == nullptr)
+    {
+        return false;
+    }
+
+    out_param = std::move(*front->element());
+    node_traits::destroy(alloc, front->element());
+
+    // The front node becomes the sentinel, the old sentinel is freed
+    destroy_node(head);
+    head = front;
+
+    return true;
+}
+
+template <typename T, class Allocator>
+T& concurrent_mpsc_list<T, Allocator>::pop_front(reference out_param)
+{
+    while (!try_pop_front(out_param))
+    {
+        std::this_thread::yield();
+    }
+
+    return out_param;
+}
+
+/****** CAPACITY ******/
+
+template <typename T, class Allocator>
+bool concurrent_mpsc_list<T, Allocator>::empty() const
+{
+    return head->next.load(std::memory_order_acquire) == nullptr;
+}
+
+/****** ALLOCATOR ******/
+
+template <typename T, class Allocator>
+typename concurrent_mpsc_list<T, Allocator>::allocator_type
+concurrent_mpsc_list<T, Allocator>::get_allocator() const
+{
+    return allocator_type(alloc);
+}
+
+/****** NODE MANAGEMENT ******/
+
+template <typename T, class Allocator>
+typename concurrent_mpsc_list<T, Allocator>::Node*
+concurrent_mpsc_list<T, Allocator>::create_node()
+{
+    Node* node = node_traits::allocate(alloc, 1);
+
+    // Only the link is initialized, the caller constructs the element
+    node_traits::construct(alloc, node);
+    return node;
+}
+
+template <typename T, class Allocator>
+void concurrent_mpsc_list<T, Allocator>::link_back(Node* node)
+{
+    // Claiming the back orders producers, acq_rel publishes the element to
+    // the next producer and sees the previous producer's node
+    Node* prev = tail.exchange(node, std::memory_order_acq_rel);
+
+    // Until this store the consumer cannot reach node or anything after it
+    prev->next.store(node, std::memory_order_release);
+}
+
+template <typename T, class Allocator>
+void concurrent_mpsc_list<T, Allocator>::destroy_node(Node* node)
+{
+    node_traits::destroy(alloc, node);
+    node_traits::deallocate(alloc, node, 1);
+}
+
+#endif //CONCURRENT_MPSC_LIST_CPP
@@ -0,0 +1,326 @@
+/*
+
+ File: concurrent_ordered_set.cpp
+
+ Brief: Implementation file for the concurrent_ordered_set data structure
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef CONCURRENT_ORDERED_SET_CPP
+#define CONCURRENT_ORDERED_SET_CPP
+
+#include "concurrent_ordered_set.hpp"
+
+template <typename T, class Compare, class Allocator>
+const typename concurrent_ordered_set<T, Compare, Allocator>::size_type
+concurrent_ordered_set<T, Compare, Allocator>::hazards_per_record;
+
+template <typename T, class Compare, class Allocator>
+const typename concurrent_ordered_set<T, Compare, Allocator>::size_type
+concurrent_ordered_set<T, Compare, Allocator>::cache_line;
+
+/****** CONSTRUCTORS ******/
+
+// default constructor
+template <typename T, class Compare, class Allocator>
+concurrent_ordered_set<T, Compare, Allocator>::concurrent_ordered_set()
+    : concurrent_ordered_set(value_compare()) {}
+
+// comparison and allocator constructor
+template <typename T, class Compare, class Allocator>
+concurrent_ordered_set<T, Compare, Allocator>::concurrent_ordered_set(const value_compare& comp,
+                                                                      const allocator_type& alloc)
+    : head(nullptr), count(0), comp(comp), alloc(alloc),
+      domain(node_deleter { this->alloc }, this->alloc) {}
+
+// Destructor
+template <typename T, class Compare, class Allocator>
+concurrent_ordered_set<T, Compare, Allocator>::~concurrent_ordered_set()
+{
+    // Linked nodes are destroyed here, the domain then frees unlinked ones
+    Node* node = head.load(std::memory_order_acquire);
+    while (node != nullptr)
+    {
+        Node* next = unmarked(node->next.load(std::memory_order_relaxed));
+        destroy_node(node);
+        node = next;
+    }
+}
+
+/****** MODIFIERS ******/
+
+template <typename T, class Compare, class Allocator>
+bool concurrent_ordered_set<T, Compare, Allocator>::insert(const_reference data)
+{
+    return emplace(data);
+}
+
+template <typename T, class Compare, class Allocator>
+bool concurrent_ordered_set<T, Compare, Allocator>::insert(T&& data)
+{
+    return emplace(std::move(data));
+}
+
+template <typename T, class Compare, class Allocator>
+template <class... Args>
+bool concurrent_ordered_set<T, Compare, Allocator>::emplace(Args&&... args)
+{
+    Node* node = node_traits::allocate(alloc, 1);
+
+    try
+    {
+        node_traits::construct(alloc, node, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        node_traits::deallocate(alloc, node, 1);
+        throw;
+    }
+
+    return link(node);
+}
+
+template <typename T, class Compare, class Allocator>
+bool concurrent_ordered_set<T, Compare, Allocator>::erase(const_reference target)
+{
+    hazard_record* record = domain.acquire_record();
+    window found = { nullptr, nullptr };
+
+    try
+    {
+        while (search(record, target, found))
+        {
+            Node* next = found.current->next.load(std::memory_order_acquire);
+
+            // Marking the link deletes the element, only one thread can
+            if (is_marked(next) ||
+                !found.current->next.compare_exchange_strong(next, marked(next),
+                                                             std::memory_order_seq_cst,
+                                                             std::memory_order_acquire))
+            {
+                continue;
+            }
+            --count;
+
+            // If the predecessor changed, a search unlinks the node for us.
+            // Unlinking is sequentially consistent, so that a reclaim
+            // scanning the hazards afterwards sees every thread that
+            // published the node before it
+            Node* expected = found.current;
+            if (found.prev->compare_exchange_strong(expected, next, std::memory_order_seq_cst,
+                                                    std::memory_order_acquire))
+            {
+                domain.retire(record, found.current);
+            }
+            else
+            {
+                search(record, target, found);
+            }
+
+            domain.release_record(record);
+            return true;
+        }
+    }
+    catch (...)
+    {
+        domain.release_record(record);
+        throw;
+    }
+
+    domain.release_record(record);
+    return false;
+}
+
+/****** LOOKUP ******/
+
+template <typename T, class Compare, class Allocator>
+bool concurrent_ordered_set<T, Compare, Allocator>::contains(const_reference target) const
+{
+    hazard_record* record = domain.acquire_record();
+    window found = { nullptr, nullptr };
+    bool result = false;
+
+    try
+    {
+        result = search(record, target, found);
+    }
+    catch (...)
+    {
+        domain.release_record(record);
+        throw;
+    }
+
+    domain.release_record(record);
+    return result;
+}
+
+/****** CAPACITY ******/
+
+template <typename T, class Compare, class Allocator>
+bool concurrent_ordered_set<T, Compare, Allocator>::empty() const
+{
+    return count.load(std::memory_order_relaxed) == 0;
+}
+
+template <typename T, class Compare, class Allocator>
+typename concurrent_ordered_set<T, Compare, Allocator>::size_type
+concurrent_ordered_set<T, Compare, Allocator>::size() const
+{
+    return count.load(std::memory_order_relaxed);
+}
+
+/****** OBSERVERS ******/
+
+template <typename T, class Compare, class Allocator>
+typename concurrent_ordered_set<T, Compare, Allocator>::value_compare
+concurrent_ordered_set<T, Compare, Allocator>::value_comp() const
+{
+    return comp;
+}
+
+template <typename T, class Compare, class Allocator>
+typename concurrent_ordered_set<T, Compare, Allocator>::allocator_type
+concurrent_ordered_set<T, Compare, Allocator>::get_allocator() const
+{
+    return allocator_type(alloc);
+}
+
+/****** LIST OPERATIONS ******/
+
+template <typename T, class Compare, class Allocator>
+bool concurrent_ordered_set<T, Compare, Allocator>::is_marked(const Node* node)
+{
+    return (reinterpret_cast<std::uintptr_t>(node) & 1) != 0;
+}
+
+template <typename T, class Compare, class Allocator>
+typename concurrent_ordered_set<T, Compare, Allocator>::Node*
+concurrent_ordered_set<T, Compare, Allocator>::marked(Node* node)
+{
+    return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(node) | 1);
+}
+
+template <typename T, class Compare, class Allocator>
+typename concurrent_ordered_set<T, Compare, Allocator>::Node*
+concurrent_ordered_set<T, Compare, Allocator>::unmarked(Node* node)
+{
+    return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(node)
+                                   & ~static_cast<std::uintptr_t>(1));
+}
+
+template <typename T, class Compare, class Allocator>
+bool concurrent_ordered_set<T, Compare, Allocator>::search(hazard_record* record,
+                                                           const_reference target,
+                                                           window& found) const
+{
+    std::atomic<Node*>& prev_hazard = record->hazards[0];
+    std::atomic<Node*>& current_hazard = record->hazards[1];
+
+    for (;;)
+    {
+        std::atomic<Node*>* prev = &head;
+        Node* current = prev->load(std::memory_order_acquire);
+        bool restart = false;
+
+        while (!restart)
+        {
+            if (current == nullptr)
+            {
+                found = { prev, nullptr };
+                return false;
+            }
+
+            // Publish current, then check prev still links to it. If it does,
+            // current was not unlinked before it was published
+            current_hazard.store(current, std::memory_order_seq_cst);
+            if (prev->load(std::memory_order_seq_cst) != current)
+            {
+                restart = true;
+                continue;
+            }
+
+            Node* next = current->next.load(std::memory_order_acquire);
+
+            // current is deleted, unlink it. A failed exchange means prev
+            // changed or was itself marked, the walk starts over
+            if (is_marked(next))
+            {
+                Node* expected = current;
+                if (!prev->compare_exchange_strong(expected, unmarked(next),
+                                                   std::memory_order_seq_cst,
+                                                   std::memory_order_acquire))
+                {
+                    restart = true;
+                    continue;
+                }
+
+                domain.retire(record, current);
+                current = unmarked(next);
+                continue;
+            }
+
+            if (!comp(current->data, target))
+            {
+                found = { prev, current };
+                return !comp(target, current->data);
+            }
+
+            // current becomes the predecessor, it stays published as such
+            prev_hazard.store(current, std::memory_order_seq_cst);
+            prev = &current->next;
+            current = next;
+        }
+    }
+}
+
+template <typename T, class Compare, class Allocator>
+bool concurrent_ordered_set<T, Compare, Allocator>::link(Node* node)
+{
+    hazard_record* record = domain.acquire_record();
+    window found = { nullptr, nullptr };
+
+    try
+    {
+        while (!search(record, node->data, found))
+        {
+            // node is private until the exchange, its link is a plain store
+            node->next.store(found.current, std::memory_order_relaxed);
+
+            Node* expected = found.current;
+            if (found.prev->compare_exchange_strong(expected, node, std::memory_order_acq_rel,
+                                                    std::memory_order_acquire))
+            {
+                ++count;
+                domain.release_record(record);
+                return true;
+            }
+        }
+    }
+    catch (...)
+    {
+        domain.release_record(record);
+        destroy_node(node);
+        throw;
+    }
+
+    domain.release_record(record);
+    destroy_node(node);
+    return false;
+}
+
+template <typename T, class Compare, class Allocator>
+void concurrent_ordered_set<T, Compare, Allocator>::destroy_node(Node* node) const
+{
+    node_traits::destroy(alloc, node);
+    node_traits::deallocate(alloc, node, 1);
+}
+
+#endif //CONCURRENT_ORDERED_SET_CPP
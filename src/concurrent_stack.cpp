@@ -0,0 +1,202 @@
+/*
+
+ File: concurrent_stack.cpp
+
+ Brief: Implementation file for the concurrent_stack data structure
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef CONCURRENT_STACK_CPP
+#define CONCURRENT_STACK_CPP
+
+#include "concurrent_stack.hpp"
+
+template <typename T, class Allocator>
+const typename concurrent_stack<T, Allocator>::size_type
+concurrent_stack<T, Allocator>::cache_line;
+
+/****** CONSTRUCTORS ******/
+
+// default constructor
+template <typename T, class Allocator>
+concurrent_stack<T, Allocator>::concurrent_stack()
+    : concurrent_stack(allocator_type()) {}
+
+// allocator constructor
+template <typename T, class Allocator>
+concurrent_stack<T, Allocator>::concurrent_stack(const allocator_type& alloc)
+    : top(nullptr), alloc(alloc), domain(node_deleter { this->alloc }, this->alloc) {}
+
+// Destructor
+template <typename T, class Allocator>
+concurrent_stack<T, Allocator>::~concurrent_stack()
+{
+    // The remaining elements are destroyed by a list that adopts them, the
+    // domain then frees the popped nodes
+    pop_all();
+}
+
+/****** MODIFIERS ******/
+
+template <typename T, class Allocator>
+concurrent_stack<T, Allocator>& concurrent_stack<T, Allocator>::push_front(const_reference data)
+{
+    return emplace_front(data);
+}
+
+template <typename T, class Allocator>
+concurrent_stack<T, Allocator>& concurrent_stack<T, Allocator>::push_front(T&& data)
+{
+    return emplace_front(std::move(data));
+}
+
+template <typename T, class Allocator>
+template <class... Args>
+concurrent_stack<T, Allocator>& concurrent_stack<T, Allocator>::emplace_front(Args&&... args)
+{
+    Node* node = node_traits::allocate(alloc, 1);
+
+    try
+    {
+        node_traits::construct(alloc, node, nullptr, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        node_traits::deallocate(alloc, node, 1);
+        throw;
+    }
+
+    // The node is private until the exchange succeeds, so next is a plain
+    // pointer. Release publishes the element along with the node
+    node->next = top.load(std::memory_order_relaxed);
+    while (!top.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                      std::memory_order_relaxed))
+    {
+    }
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+bool concurrent_stack<T, Allocator>::try_pop_front(reference out_param)
+{
+    hazard_record* record = domain.acquire_record();
+    Node* node = top.load(std::memory_order_acquire);
+
+    while (node != nullptr)
+    {
+        // Publish the node, then check it is still the top. If it is, any
+        // thread that pops it afterwards sees the hazard and keeps it alive
+        record->hazards[0].store(node, std::memory_order_seq_cst);
+        if (top.load(std::memory_order_seq_cst) != node)
+        {
+            node = top.load(std::memory_order_acquire);
+            continue;
+        }
+
+        // Sequentially consistent, so that a reclaim scanning the hazards
+        // after the pop sees every thread that published the node before it
+        if (top.compare_exchange_strong(node, node->next, std::memory_order_seq_cst,
+                                        std::memory_order_acquire))
+        {
+            break;
+        }
+    }
+
+    record->hazards[0].store(nullptr, std::memory_order_release);
+
+    if (node == nullptr)
+    {
+        domain.release_record(record);
+        return false;
+    }
+
+    // This thread alone popped the node, its data is now safe to use
+    try
+    {
+        out_param = std::move(node->data);
+    }
+    catch (...)
+    {
+        node_traits::destroy(alloc, std::addressof(node->data));
+        domain.retire(record, node);
+        domain.release_record(record);
+        throw;
+    }
+
+    node_traits::destroy(alloc, std::addressof(node->data));
+    domain.retire(record, node);
+    domain.release_record(record);
+    return true;
+}
+
+template <typename T, class Allocator>
+T& concurrent_stack<T, Allocator>::pop_front(reference out_param)
+{
+    while (!try_pop_front(out_param))
+    {
+        std::this_thread::yield();
+    }
+
+    return out_param;
+}
+
+template <typename T, class Allocator>
+typename concurrent_stack<T, Allocator>::list_type concurrent_stack<T, Allocator>::pop_all()
+{
+    list_type list(get_allocator());
+
+    Node* first = top.exchange(nullptr, std::memory_order_seq_cst);
+    if (first == nullptr)
+    {
+        return list;
+    }
+
+    // Threads that published a node before the exchange may still read its
+    // next pointer. Once they see the top has changed they retry elsewhere,
+    // so only hazards published before the exchange need to clear. The
+    // exchange is sequentially consistent so that none of them is missed
+    domain.wait_for_published();
+
+    Node* last = first;
+    size_type count = 0;
+    for (Node* node = first; node != nullptr; node = node->next)
+    {
+        last = node;
+        ++count;
+    }
+
+    list.head = first;
+    list.tail = last;
+    list.count = count;
+    list.note_held();
+
+    return list;
+}
+
+/****** CAPACITY ******/
+
+template <typename T, class Allocator>
+bool concurrent_stack<T, Allocator>::empty() const
+{
+    return top.load(std::memory_order_acquire) == nullptr;
+}
+
+/****** ALLOCATOR ******/
+
+template <typename T, class Allocator>
+typename concurrent_stack<T, Allocator>::allocator_type
+concurrent_stack<T, Allocator>::get_allocator() const
+{
+    return allocator_type(alloc);
+}
+
+#endif //CONCURRENT_STACK_CPP
@@ -0,0 +1,215 @@
+/*
+
+ File: hazard_domain.cpp
+
+ Brief: Implementation file for the hazard_domain used by the lock-free
+        containers
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef HAZARD_DOMAIN_CPP
+#define HAZARD_DOMAIN_CPP
+
+#include "hazard_domain.hpp"
+
+template <class Node, class Deleter, class Allocator, std::size_t Hazards>
+const typename hazard_domain<Node, Deleter, Allocator, Hazards>::size_type
+hazard_domain<Node, Deleter, Allocator, Hazards>::retire_threshold;
+
+/****** CONSTRUCTORS ******/
+
+template <class Node, class Deleter, class Allocator, std::size_t Hazards>
+hazard_domain<Node, Deleter, Allocator, Hazards>::hazard_domain(const deleter_type& free,
+                                                                const allocator_type& alloc)
+    : records(nullptr), free(free), alloc(alloc) {}
+
+// Destructor
+template <class Node, class Deleter, class Allocator, std::size_t Hazards>
+hazard_domain<Node, Deleter, Allocator, Hazards>::~hazard_domain()
+{
+    hazard_record* record = records.load(std::memory_order_acquire);
+    while (record != nullptr)
+    {
+        hazard_record* next = record->next;
+
+        // No thread is left to publish a hazard, every retired node is freed
+        for (Node* node : record->retired)
+        {
+            free(node);
+        }
+
+        record_traits::destroy(alloc, record);
+        record_traits::deallocate(alloc, record, 1);
+        record = next;
+    }
+}
+
+/****** RECORDS ******/
+
+template <class Node, class Deleter, class Allocator, std::size_t Hazards>
+typename hazard_domain<Node, Deleter, Allocator, Hazards>::hazard_record*
+hazard_domain<Node, Deleter, Allocator, Hazards>::acquire_record()
+{
+    hazard_record* record = records.load(std::memory_order_acquire);
+    for (; record != nullptr; record = record->next)
+    {
+        if (!record->active.load(std::memory_order_relaxed)
+            && !record->active.exchange(true, std::memory_order_acquire))
+        {
+            return record;
+        }
+    }
+
+    // Every record is in use, add one. Records are only freed with the domain
+    record = record_traits::allocate(alloc, 1);
+    try
+    {
+        record_traits::construct(alloc, record, pointer_allocator(alloc));
+
+        // Room for a full queue up front, the queue is reclaimed once full
+        record->retired.reserve(retire_threshold);
+    }
+    catch (...)
+    {
+        record_traits::destroy(alloc, record);
+        record_traits::deallocate(alloc, record, 1);
+        throw;
+    }
+
+    record->next = records.load(std::memory_order_relaxed);
+    while (!records.compare_exchange_weak(record->next, record, std::memory_order_release,
+                                          std::memory_order_relaxed))
+    {
+    }
+
+    return record;
+}
+
+template <class Node, class Deleter, class Allocator, std::size_t Hazards>
+void hazard_domain<Node, Deleter, Allocator, Hazards>::release_record(hazard_record* record)
+{
+    for (std::atomic<Node*>& hazard : record->hazards)
+    {
+        hazard.store(nullptr, std::memory_order_release);
+    }
+
+    // Release hands the retired nodes over to the record's next owner
+    record->active.store(false, std::memory_order_release);
+}
+
+/****** RECLAMATION ******/
+
+template <class Node, class Deleter, class Allocator, std::size_t Hazards>
+void hazard_domain<Node, Deleter, Allocator, Hazards>::retire(hazard_record* record, Node* node)
+{
+    pointer_vector& retired = record->retired;
+
+    // The queue only grows when every node in it is still published. If it
+    // cannot grow, wait for a thread to clear its hazard instead of throwing
+    while (retired.size() == retired.capacity())
+    {
+        reclaim(record);
+        if (retired.size() < retired.capacity())
+        {
+            break;
+        }
+
+        try
+        {
+            retired.reserve(2 * retired.capacity());
+        }
+        catch (...)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    retired.push_back(node);
+}
+
+template <class Node, class Deleter, class Allocator, std::size_t Hazards>
+void hazard_domain<Node, Deleter, Allocator, Hazards>::reclaim(hazard_record* record)
+{
+    pointer_vector& retired = record->retired;
+
+    // Published nodes are marked in the sorted queue, which needs no memory
+    std::sort(retired.begin(), retired.end());
+
+    hazard_record* other = records.load(std::memory_order_acquire);
+    for (; other != nullptr; other = other->next)
+    {
+        for (const std::atomic<Node*>& published : other->hazards)
+        {
+            Node* hazard = published.load(std::memory_order_seq_cst);
+            typename pointer_vector::iterator found =
+                std::lower_bound(retired.begin(), retired.end(), hazard);
+
+            if (hazard != nullptr && found != retired.end() && unmarked(*found) == hazard)
+            {
+                *found = marked(hazard);
+            }
+        }
+    }
+
+    size_type kept = 0;
+    for (Node* node : retired)
+    {
+        // A published node may still be read, keep it for the next reclaim
+        if (is_marked(node))
+        {
+            retired[kept++] = unmarked(node);
+        }
+        else
+        {
+            free(node);
+        }
+    }
+
+    retired.resize(kept);
+}
+
+template <class Node, class Deleter, class Allocator, std::size_t Hazards>
+void hazard_domain<Node, Deleter, Allocator, Hazards>::wait_for_published() const
+{
+    hazard_record* record = records.load(std::memory_order_acquire);
+    for (; record != nullptr; record = record->next)
+    {
+        for (const std::atomic<Node*>& published : record->hazards)
+        {
+            Node* hazard = published.load(std::memory_order_seq_cst);
+            while (hazard != nullptr && published.load(std::memory_order_seq_cst) == hazard)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+}
+
+template <class Node, class Deleter, class Allocator, std::size_t Hazards>
+bool hazard_domain<Node, Deleter, Allocator, Hazards>::is_marked(const Node* node)
+{
+    return (reinterpret_cast<std::uintptr_t>(node) & 1) != 0;
+}
+
+template <class Node, class Deleter, class Allocator, std::size_t Hazards>
+Node* hazard_domain<Node, Deleter, Allocator, Hazards>::marked(Node* node)
+{
+    return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(node) | 1);
+}
+
+template <class Node, class Deleter, class Allocator, std::size_t Hazards>
+Node* hazard_domain<Node, Deleter, Allocator, Hazards>::unmarked(Node* node)
+{
+    return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(node)
+                                   & ~static_cast<std::uintptr_t>(1));
+}
+
+#endif //HAZARD_DOMAIN_CPP
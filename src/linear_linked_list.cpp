@@ -22,76 +22,121 @@
 /****** CONSTRUCTORS ******/
 
 // default constructor
-template <typename T>
-linear_linked_list<T>::linear_linked_list() 
-    : head(nullptr), tail(nullptr) {}
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>::linear_linked_list() 
+    : head(nullptr), tail(nullptr), count(0), alloc(), 
+      pool(nullptr), pool_size(0), pool_capacity(0) {}
+
+// allocator constructor
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>::linear_linked_list(const allocator_type& alloc)
+    : head(nullptr), tail(nullptr), count(0), alloc(alloc),
+      pool(nullptr), pool_size(0), pool_capacity(0) {}
 
 // ranged based constructor
-template <typename T>
+template <typename T, class Allocator>
 template <class InputIterator>
-linear_linked_list<T>::linear_linked_list(InputIterator begin, InputIterator end) 
-    : linear_linked_list()
+linear_linked_list<T, Allocator>::linear_linked_list(InputIterator begin, 
+                                                     InputIterator end,
+                                                     const allocator_type& alloc)
+    : linear_linked_list(alloc)
 {
-    for(; begin != end; ++begin)
-    {
-        push_back(*begin);
-    }
+    append_range(begin, end, 
+        typename std::iterator_traits<InputIterator>::iterator_category());
 }
 
 // Initializer List
-template <typename T>
-linear_linked_list<T>::linear_linked_list(std::initializer_list<value_type> init)
-    : linear_linked_list()
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>::linear_linked_list(std::initializer_list<value_type> init,
+                                                     const allocator_type& alloc)
+    : linear_linked_list(alloc)
 {
-    for (const_reference element : init)
-    {
-        push_back(element);
-    }
+    append_copies(init.begin(), init.size());
 }
 
 // Copy constructor
-template <typename T>
-linear_linked_list<T>::linear_linked_list(const self_type& origin) 
-    : linear_linked_list()
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>::linear_linked_list(const self_type& origin) 
+    : linear_linked_list(origin, 
+        std::allocator_traits<Allocator>::select_on_container_copy_construction(
+            origin.get_allocator())) {}
+
+// Copy constructor with allocator
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>::linear_linked_list(const self_type& origin,
+                                                     const allocator_type& alloc) 
+    : linear_linked_list(alloc)
 {
-    const_iterator it;
-    for (it = origin.begin(); it != origin.end(); ++it)
-    {
-        push_back(*it);
-    }
+    operation_scope scope(operation::copy);
+
+    append_copies(origin.begin(), origin.count);
 }
 
 // Move constructor
-template <typename T>
-linear_linked_list<T>::linear_linked_list(self_type&& origin)
-    : linear_linked_list()
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>::linear_linked_list(self_type&& origin)
+    : head(nullptr), tail(nullptr), count(0), alloc(std::move(origin.alloc)),
+      pool(nullptr), pool_size(0), pool_capacity(0)
 {
-    origin.swap(*this);
+    std::swap(head, origin.head);
+    std::swap(tail, origin.tail);
+    std::swap(count, origin.count);
+
+    // The pooled nodes belong to the allocator that was moved
+    swap_pool(origin);
+    note_held();
+}
+
+// Move constructor with allocator
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>::linear_linked_list(self_type&& origin,
+                                                     const allocator_type& alloc)
+    : linear_linked_list(alloc)
+{
+    if (this->alloc == origin.alloc)
+    {
+        std::swap(head, origin.head);
+        std::swap(tail, origin.tail);
+        std::swap(count, origin.count);
+        note_held();
+        return;
+    }
+
+    // Nodes cannot be freed by a different allocator, move each element
+    for (reference element : origin)
+    {
+        push_back(std::move(element));
+    }
+    origin.clear();
 }
 
 // Destructor
-template <typename T>
-linear_linked_list<T>::~linear_linked_list()
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>::~linear_linked_list()
 {
+    // Nothing will be inserted again, so skip pooling the cleared nodes
+    pool_capacity = 0;
+
     clear();
+    release_pool();
 }
 
 /****** MODIFIERS ******/
 
-template <typename T>
-linear_linked_list<T>& linear_linked_list<T>::push_front(const_reference data)
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::push_front(const_reference data)
 {
-    return push_front(new Node(data, head));
+    return push_front(create_node(head, data));
 }
 
-template <typename T>
-linear_linked_list<T>& linear_linked_list<T>::push_front(T&& data)
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::push_front(T&& data)
 {
-    return push_front(new Node(std::forward<T>(data), head));
+    return push_front(create_node(head, std::forward<T>(data)));
 }
 
-template <typename T>
-linear_linked_list<T>& linear_linked_list<T>::push_front(Node* node)
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::push_front(Node* node)
 {
     head = node;
 
@@ -103,20 +148,20 @@ linear_linked_list<T>& linear_linked_list<T>::push_front(Node* node)
     return *this;
 }
 
-template <typename T>
-linear_linked_list<T>& linear_linked_list<T>::push_back(const_reference& data)
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::push_back(const_reference& data)
 {
-    return push_back(new Node(data));
+    return push_back(create_node(nullptr, data));
 }
 
-template <typename T>
-linear_linked_list<T>& linear_linked_list<T>::push_back(T&& data)
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::push_back(T&& data)
 {
-    return push_back(new Node(std::forward<T>(data)));
+    return push_back(create_node(nullptr, std::forward<T>(data)));
 }
 
-template <typename T>
-linear_linked_list<T>& linear_linked_list<T>::push_back(Node* node)
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::push_back(Node* node)
 {
     if(empty())
     {
@@ -129,10 +174,40 @@ linear_linked_list<T>& linear_linked_list<T>::push_back(Node* node)
     return *this;
 }
 
+template <typename T, class Allocator>
+template <class... Args>
+T& linear_linked_list<T, Allocator>::emplace_front(Args&&... args)
+{
+    return push_front(create_node(head, std::forward<Args>(args)...)).head->data;
+}
+
+template <typename T, class Allocator>
+template <class... Args>
+T& linear_linked_list<T, Allocator>::emplace_back(Args&&... args)
+{
+    return push_back(create_node(nullptr, std::forward<Args>(args)...)).tail->data;
+}
+
+template <typename T, class Allocator>
+template <class... Args>
+typename linear_linked_list<T, Allocator>::iterator
+linear_linked_list<T, Allocator>::emplace_after(const_iterator pos, Args&&... args)
+{
+    throw_if_null(pos.node);
+
+    Node* node = create_node(pos.node->next, std::forward<Args>(args)...);
+    pos.node->next = node;
+
+    if (tail == pos.node)
+    {
+        tail = node;
+    }
 
+    return iterator(node);
+}
 
-template <typename T>
-linear_linked_list<T>& linear_linked_list<T>::pop_front()
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::pop_front()
 {
     if (empty())
     {
@@ -147,15 +222,15 @@ linear_linked_list<T>& linear_linked_list<T>::pop_front()
         tail = temp;
     }
 
-    delete head;
+    destroy_node(head);
 
     head = temp;
 
     return *this;
 }
 
-template <typename T>
-T& linear_linked_list<T>::pop_front(reference out_param)
+template <typename T, class Allocator>
+T& linear_linked_list<T, Allocator>::pop_front(reference out_param)
 {
     if(!empty())
     {
@@ -167,410 +242,2315 @@ T& linear_linked_list<T>::pop_front(reference out_param)
     return out_param;
 }
 
-template <typename T>
-linear_linked_list<T>& linear_linked_list<T>::clear()
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::clear()
 {
+    operation_scope scope(operation::clear);
+
     if(empty())
     {
         return *this;
     }
 
-    // clear_list is a recursive function that deletes each node of the list
+    // Nothing to destroy or pool and nothing to free, so just drop the nodes
+    if (std::is_trivially_destructible<value_type>::value 
+        && pool_size >= pool_capacity && deallocation_is_noop(alloc))
+    {
+        note_freed(count);
+        head = tail = nullptr;
+        count = 0;
+        return *this;
+    }
+
+    // clear_list deletes each node of the list
     clear_list(head);
 
     tail = nullptr;
+    count = 0;
 
     return *this;
 }
 
-template <typename T>
-void linear_linked_list<T>::clear_list(Node*& current)
+template <typename T, class Allocator>
+template <class InputIterator>
+linear_linked_list<T, Allocator>& 
+linear_linked_list<T, Allocator>::assign(InputIterator first, InputIterator last)
 {
-    // While the current node pointer is not at the end of the list
-    if (current != tail)
-    {
-        // Recursive call to travel to the end of the list
-        clear_list(current->next);
-    }
+    operation_scope scope(operation::assign);
 
-    // Deletes the current node as the stack unwinds
-    delete current;
-    current = nullptr;
+    assign_range(first, last, 
+        typename std::iterator_traits<InputIterator>::iterator_category());
 
-    return;
+    return *this;
 }
 
-template <typename T>
-linear_linked_list<T>& linear_linked_list<T>::reverse()
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& 
+linear_linked_list<T, Allocator>::assign(std::initializer_list<value_type> init)
 {
-    if(!empty())
-    {
-        reverse(head);
+    operation_scope scope(operation::assign);
+
+    assign_copies(init.begin(), init.size());
 
-        std::swap(head, tail);
-    }
     return *this;
 }
 
-template <typename T>
-void linear_linked_list<T>::reverse(Node* current, Node* prev)
+template <typename T, class Allocator>
+template <class InputIterator>
+void linear_linked_list<T, Allocator>::assign_range(InputIterator first, 
+                                                    InputIterator last, 
+                                                    std::input_iterator_tag)
 {
-    if(current->next != nullptr)
+    // The length is unknown, overwrite elements until either side runs out
+    Node* prev = nullptr;
+    Node* node = head;
+    size_type assigned = 0;
+    for (; node != nullptr && first != last; ++first, ++assigned)
     {
-        reverse(current->next, current);
+        node->data = *first;
+        prev = node;
+        node = node->next;
+        note_hops();
     }
 
-    current->next = prev;
+    if (node == nullptr)
+    {
+        append_range(first, last, std::input_iterator_tag());
+        return;
+    }
 
-    return;
+    truncate_after(prev, assigned);
 }
 
-template <typename T>
-linear_linked_list<T>& linear_linked_list<T>::sort()
+template <typename T, class Allocator>
+template <class ForwardIterator>
+void linear_linked_list<T, Allocator>::assign_range(ForwardIterator first, 
+                                                    ForwardIterator last, 
+                                                    std::forward_iterator_tag)
 {
-    return sort([](const T& lhs, const T& rhs){ return lhs < rhs; });
+    assign_copies(first, static_cast<size_type>(std::distance(first, last)));
 }
 
-template <typename T>
-template <class Compare>
-linear_linked_list<T>& linear_linked_list<T>::sort(Compare&& comp)
+template <typename T, class Allocator>
+template <class ForwardIterator>
+void linear_linked_list<T, Allocator>::assign_copies(ForwardIterator first, size_type n)
 {
-    if(head == nullptr || head->next == nullptr)
+    if (n > count)
     {
-        return *this;
-    }
+        // Append the extra elements first, so that a failure leaves only 
+        // them to undo, then overwrite the existing elements
+        Node* old_tail = tail;
+        size_type old_count = count;
 
-    linear_linked_list<T> right = split(middle());
-
-    sort(comp);
-    right.sort(comp);
-
-    return merge(right, comp);
-}
+        try
+        {
+            ForwardIterator extra = first;
+            std::advance(extra, count);
+            append_copies(extra, n - count);
+        }
+        catch (...)
+        {
+            truncate_after(old_tail, old_count);
+            throw;
+        }
 
-template <typename T>
-linear_linked_list<T> linear_linked_list<T>::split(const_iterator pos)
-{
-    linear_linked_list<T> temp;
+        for (Node* node = head; old_count > 0; --old_count, ++first)
+        {
+            node->data = *first;
+            node = node->next;
+            note_hops();
+        }
+        return;
+    }
 
-    if(pos.node != nullptr)
+    Node* prev = nullptr;
+    Node* node = head;
+    for (size_type i = 0; i < n; ++i, ++first)
     {
-        temp.head = pos.node->next;
-        temp.tail = (temp.head == nullptr) ? nullptr : tail;
-
-        tail = pos.node;
-        tail->next = nullptr;
+        node->data = *first;
+        prev = node;
+        node = node->next;
+        note_hops();
     }
-    return temp;
-}
 
-template <typename T>
-linear_linked_list<T>& linear_linked_list<T>::merge(self_type& list)
-{
-    return merge(list, [](const T& lhs, const T& rhs){ return lhs < rhs; });
+    truncate_after(prev, n);
 }
 
-template <typename T>
-template <class Compare>
-linear_linked_list<T>& linear_linked_list<T>::merge(self_type& list, Compare&& comp)
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::truncate_after(Node* last, size_type remaining)
 {
-    if(&list != this)
-    {
-        head = merge(head, list.head, comp);
-
-        // set tail to the "greater" of the two tails OR whichever tail isn't null
-        tail = !tail || (list.tail && comp(tail->data, list.tail->data))
-             ? list.tail : tail;
+    Node* surplus = (last == nullptr) ? head : last->next;
 
-        // Merge does not copy, source must relinquish resources
-        list.head = list.tail = nullptr;
+    if (last == nullptr)
+    {
+        head = nullptr;
+    }
+    else
+    {
+        last->next = nullptr;
     }
-    return *this;
-}
-
-template <typename T>
-template <class Compare>
-typename linear_linked_list<T>::Node* 
-linear_linked_list<T>::merge(Node* self, Node* other, Compare&& comp)
-{
-    // Base case : self OR other list is empty return the non-empty list
-    if (self == nullptr) { return other; }
-    if (other == nullptr) { return self; }
 
-    bool comparison = comp(self->data, other->data);
+    clear_list(surplus);
 
-    Node* head = comparison ? self : other;
-    head->next = comparison ? merge(self->next, other, comp) 
-                            : merge(self, other->next, comp);
-    return head;
+    tail = last;
+    count = remaining;
 }
 
-template <typename T>
-typename linear_linked_list<T>::iterator
-linear_linked_list<T>::erase_after(iterator pos)
+template <typename T, class Allocator>
+template <class InputIterator>
+void linear_linked_list<T, Allocator>::append_range(InputIterator first, 
+                                                    InputIterator last, 
+                                                    std::input_iterator_tag)
 {
-    if(!empty() && pos.node != tail)
+    // The length is unknown until the range is consumed
+    for(; first != last; ++first)
     {
-        Node* temp = pos.node->next;
-        pos.node->next = temp->next;
-        delete temp;
+        push_back(*first);
     }
-    return pos;
 }
 
-template <typename T>
-int linear_linked_list<T>::remove(const_reference target)
+template <typename T, class Allocator>
+template <class ForwardIterator>
+void linear_linked_list<T, Allocator>::append_range(ForwardIterator first, 
+                                                    ForwardIterator last, 
+                                                    std::forward_iterator_tag)
 {
-    // lambda catches target and compares it to each element in the list
-    return remove_if([&target](T& sample){ return target == sample; });
+    append_copies(first, static_cast<size_type>(std::distance(first, last)));
 }
 
-template <typename T>
-template <class Predicate>
-int linear_linked_list<T>::remove_if(Predicate&& pred)
-{
-    if (empty())
-    {
-        return 0;
-    }
-    
-    return remove_if(pred, head);
-}
+template <typename T, class Allocator>
+const typename linear_linked_list<T, Allocator>::size_type 
+linear_linked_list<T, Allocator>::copy_batch;
 
-template <typename T>
-template <class Predicate>
-int linear_linked_list<T>::remove_if(Predicate&& pred, Node*& current, Node* prev)
+template <typename T, class Allocator>
+template <class ForwardIterator>
+void linear_linked_list<T, Allocator>::append_copies(ForwardIterator first, size_type n)
 {
-    // Base Case: Traversed the whole list
-    if(current == nullptr)
-    {
-        return 0;
-    }
+    // Nodes carved from a single allocation when deallocation does nothing
+    Node* block = nullptr;
+    size_type block_left = 0;
+    bool spares = true;
 
-    // Predicate fulfilled, remove this element
-    if(pred(current->data))
+    while (n > 0)
     {
+        Node* batch[copy_batch];
+        const size_type wanted = std::min(n, copy_batch);
+        size_type acquired = 0;
 
-        // Edge case : element to be removed is the tail. 
-        if (tail == current)
+        try
+        {
+            for (; acquired < wanted; ++acquired)
+            {
+                Node* node = spares ? take_spare_node() : nullptr;
+
+                if (node == nullptr)
+                {
+                    spares = false;
+
+                    if (block_left == 0 && deallocation_is_noop(alloc))
+                    {
+                        block_left = n - acquired;
+                        block = node_traits::allocate(alloc, block_left);
+                    }
+
+                    if (block_left > 0)
+                    {
+                        node = block++;
+                        --block_left;
+                    }
+                    else
+                    {
+                        node = node_traits::allocate(alloc, 1);
+                    }
+                    note_allocated(1);
+                }
+                batch[acquired] = node;
+            }
+        }
+        catch (...)
         {
-            tail = prev;
+            for (size_type i = 0; i < acquired; ++i)
+            {
+                recycle_node(batch[i]);
+            }
+            throw;
         }
 
-        prev = current;
+        for (size_type i = 0; i < acquired; ++i, ++first)
+        {
+            try
+            {
+                node_traits::construct(alloc, std::addressof(batch[i]->data), *first);
+            }
+            catch (...)
+            {
+                // Unused nodes of a block are left to the memory resource
+                for (; i < acquired; ++i)
+                {
+                    recycle_node(batch[i]);
+                }
+                throw;
+            }
+
+            batch[i]->next = nullptr;
+            push_back(batch[i]);
+            ++count;
+        }
+
+        n -= acquired;
+    }
 
+    note_held();
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::clear_list(Node*& current)
+{
+    // Nodes the thread cache has room for are handed over as a single chain
+    const size_type room = cache_room(shares_nodes());
+    const bool deallocate = !deallocation_is_noop(alloc);
+    size_type cached = 0;
+    size_type freed = 0;
+    Node* first = nullptr;
+    Node* last = nullptr;
+    lookahead ahead(current, prefetch_distance);
+
+    // Deletes each node from the front, keeping the stack depth constant
+    while (current != nullptr)
+    {
+        Node* node = current;
         current = current->next;
+        note_hops();
+        ahead.advance();
 
-        delete prev;
+        node_traits::destroy(alloc, std::addressof(node->data));
 
-        return 1 + remove_if(pred, current, prev=current);
+        if (pool_size < pool_capacity)
+        {
+            recycle_node(node);
+        }
+        else if (cached < room)
+        {
+            node->next = first;
+            first = node;
+            last = (last == nullptr) ? node : last;
+            ++cached;
+        }
+        else
+        {
+            // Without deallocation the node is dropped, but still counts as freed
+            if (deallocate)
+            {
+                node_traits::deallocate(alloc, node, 1);
+            }
+            ++freed;
+        }
     }
 
-    prev = current;
+    cache_nodes(first, last, cached, shares_nodes());
+    note_freed(freed);
 
-    return remove_if(pred, current->next, prev);
+    return;
 }
 
-/****** CAPACITY ******/
-
-template <typename T>
-bool linear_linked_list<T>::empty() const
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::reverse()
 {
-    return !(head);
-}
+    operation_scope scope(operation::reverse);
 
-template <typename T>
-typename linear_linked_list<T>::size_type linear_linked_list<T>::size() const
-{
-    return size(head);
+    if(!empty())
+    {
+        reverse(head);
+
+        std::swap(head, tail);
+    }
+    return *this;
 }
 
-template <typename T>
-typename linear_linked_list<T>::size_type linear_linked_list<T>::size(Node* head) const
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::reverse(Node* current, Node* prev)
 {
-    return (head != nullptr) ? 1 + size(head->next) : 0;
+    // Points each node back at its predecessor, one node at a time
+    while(current != nullptr)
+    {
+        Node* next = current->next;
+        current->next = prev;
+        prev = current;
+        current = next;
+        note_hops();
+    }
+
+    return;
 }
 
-/****** ELEMENT ACCESS ******/
+template <typename T, class Allocator>
+const typename linear_linked_list<T, Allocator>::size_type 
+linear_linked_list<T, Allocator>::gather_threshold;
 
-template <typename T>
-T& linear_linked_list<T>::front() 
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::sort(sort_strategy strategy)
 {
-    throw_if_null(head);
+    operation_scope scope(operation::sort);
 
-    return head->data;
+    return sort([](const T& lhs, const T& rhs){ return lhs < rhs; }, strategy);
 }
 
-template <typename T>
-const T& linear_linked_list<T>::front() const
+template <typename T, class Allocator>
+template <class Compare>
+linear_linked_list<T, Allocator>& 
+linear_linked_list<T, Allocator>::sort(Compare&& comp, sort_strategy strategy)
 {
-    throw_if_null(head);
+    operation_scope scope(operation::sort);
 
-    return head->data;
+    sort_nodes(comp, strategy, false);
+    return *this;
 }
 
-template <typename T>
-T& linear_linked_list<T>::back() 
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& 
+linear_linked_list<T, Allocator>::stable_sort(sort_strategy strategy)
 {
-    throw_if_null(tail);
+    operation_scope scope(operation::stable_sort);
 
-    return tail->data;
+    return stable_sort([](const T& lhs, const T& rhs){ return lhs < rhs; }, strategy);
 }
 
-template <typename T>
-const T& linear_linked_list<T>::back() const
+template <typename T, class Allocator>
+template <class Compare>
+linear_linked_list<T, Allocator>& 
+linear_linked_list<T, Allocator>::stable_sort(Compare&& comp, sort_strategy strategy)
 {
-    throw_if_null(tail);
+    operation_scope scope(operation::stable_sort);
 
-    return tail->data;
+    sort_nodes(comp, strategy, true);
+    return *this;
 }
 
-/****** ITERATORS ******/
-
-template <typename T>
-typename linear_linked_list<T>::iterator
-linear_linked_list<T>::begin()
+template <typename T, class Allocator>
+template <class Projection>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::sort_by(Projection&& proj)
 {
-    return iterator(head);
-}
+    operation_scope scope(operation::sort_by);
 
-template <typename T>
-typename linear_linked_list<T>::const_iterator 
-linear_linked_list<T>::begin() const
-{
-    return const_iterator(head);
-}
+    typedef typename std::decay<decltype(proj(std::declval<const_reference>()))>::type key_type;
 
-template <typename T>
-typename linear_linked_list<T>::iterator
-linear_linked_list<T>::end()
-{
-    return iterator(nullptr);
+    return sort_by(proj, [](const key_type& lhs, const key_type& rhs){ return lhs < rhs; });
 }
 
-template <typename T>
-typename linear_linked_list<T>::const_iterator 
-linear_linked_list<T>::end() const
+template <typename T, class Allocator>
+template <class Projection, class Compare>
+linear_linked_list<T, Allocator>& 
+linear_linked_list<T, Allocator>::sort_by(Projection&& proj, Compare&& comp)
 {
-    return const_iterator(nullptr);
-}
+    operation_scope scope(operation::sort_by);
 
-template <typename T>
-typename linear_linked_list<T>::iterator 
-linear_linked_list<T>::middle()
-{
-    return iterator(middle(head));
-}
+    typedef typename std::decay<decltype(proj(std::declval<const_reference>()))>::type key_type;
 
-template <typename T>
-typename linear_linked_list<T>::const_iterator 
-linear_linked_list<T>::middle() const
-{
-    return const_iterator(middle(head));
-}
+    struct keyed_node
+    {
+        key_type key;
+        Node* node;
+    };
+
+    typedef typename std::allocator_traits<Allocator>::template 
+            rebind_alloc<keyed_node> keyed_allocator;
 
-template <typename T>
-typename linear_linked_list<T>::Node* 
-linear_linked_list<T>::middle(Node* head) const
-{
     if(head == nullptr || head->next == nullptr)
     {
-        return head;
+        return *this;
     }
 
-    return middle(head, head->next);
-}
-
-template <typename T>
-typename linear_linked_list<T>::Node* 
-linear_linked_list<T>::middle(Node* slow, Node* fast) const
-{
-    return (fast == nullptr || (fast = fast->next) == nullptr) 
-           ? slow : middle(slow->next, fast->next);
-}
+    std::vector<keyed_node, keyed_allocator> nodes((keyed_allocator(alloc)));
 
-/****** COMPARISON OPERATORS ******/
+    try
+    {
+        nodes.reserve(count);
+    }
+    catch (const std::bad_alloc&)
+    {
+        merge_sort([&proj, &comp](const_reference lhs, const_reference rhs)
+        {
+            return comp(proj(lhs), proj(rhs));
+        });
+        return *this;
+    }
 
-template <typename T>
-bool linear_linked_list<T>::operator==(const self_type& rhs) const
-{
-    // Compare sizes first
-    if (rhs.size() != size())
+    // The list is untouched until every key has been computed
+    for (Node* node = head; node != nullptr; node = node->next)
     {
-        return false;
+        note_hops();
+        nodes.push_back(keyed_node{ proj(node->data), node });
     }
 
-    const_iterator left = begin();
-    const_iterator right = rhs.begin();
+    std::stable_sort(nodes.begin(), nodes.end(), 
+                     [&comp](const keyed_node& lhs, const keyed_node& rhs)
+    {
+        return comp(lhs.key, rhs.key);
+    });
 
-    while(left != end() && right != rhs.end())
+    // Relink the nodes in sorted order
+    for (size_type i = 0; i + 1 < nodes.size(); ++i)
     {
-        // If any element does not match then return false
-        if (*(left++) != *(right++))
+        // Sorted order scatters the writes, fetch the nodes ahead of them
+        if (prefetch_distance > 0 && i + prefetch_distance < nodes.size())
         {
-            return false;
+            prefetch(nodes[i + prefetch_distance].node);
         }
+        nodes[i].node->next = nodes[i + 1].node;
     }
 
-    return true; // TODO test left and right are both end iterators
-}
+    head = nodes.front().node;
+    tail = nodes.back().node;
+    tail->next = nullptr;
 
-template <typename T>
-bool linear_linked_list<T>::operator!=(const self_type& rhs) const
-{
-    return !(*this == rhs);
+    return *this;
 }
 
-template <typename T>
-typename linear_linked_list<T>::self_type& 
-linear_linked_list<T>::operator=(self_type copy)
+template <typename T, class Allocator>
+template <class KeyFunction>
+linear_linked_list<T, Allocator>& 
+linear_linked_list<T, Allocator>::sort_by_key(KeyFunction&& key, sort_strategy strategy)
 {
-    // Swap ownership of resources with the copy
-    swap(copy);
+    operation_scope scope(operation::sort_by_key);
+
+    typedef typename std::decay<decltype(key(std::declval<const_reference>()))>::type key_type;
+
+    static_assert(std::is_integral<key_type>::value && !std::is_same<key_type, bool>::value,
+                  "sort_by_key requires a key function returning an integral type");
+
+    typedef typename std::make_unsigned<key_type>::type radix_type;
+
+    // Flipping the sign bit orders signed keys as unsigned values
+    const radix_type flip = std::is_signed<key_type>::value 
+        ? static_cast<radix_type>(radix_type(1) << (sizeof(radix_type) * 8 - 1)) : 0;
+
+    auto radix = [&key, flip](const_reference data)
+    {
+        return static_cast<radix_type>(static_cast<radix_type>(key(data)) ^ flip);
+    };
+
+    if(head == nullptr || head->next == nullptr)
+    {
+        return *this;
+    }
+
+    // Set bits mark the key bits that differ between at least two elements
+    radix_type first = radix(head->data);
+    radix_type differs = 0;
+    for (Node* node = head->next; node != nullptr; node = node->next)
+    {
+        note_hops();
+        differs |= radix(node->data) ^ first;
+    }
+
+    if (strategy == sort_strategy::automatic)
+    {
+        strategy = (count >= gather_threshold) ? sort_strategy::gather 
+                                               : sort_strategy::merge;
+    }
+
+    if (strategy == sort_strategy::gather && gather_bucket_sort(radix, differs))
+    {
+        return *this;
+    }
+
+    bucket_sort(radix, differs);
 
-    // As the copy goes out of scope it destructs with the old data
     return *this;
 }
 
-template <typename T>
-void linear_linked_list<T>::swap(self_type& origin)
+template <typename T, class Allocator>
+template <class Radix, class Key>
+void linear_linked_list<T, Allocator>::bucket_sort(Radix&& radix, Key differs)
 {
-    using std::swap;
+    for (size_type shift = 0; shift < sizeof(Key) * 8; shift += 8)
+    {
+        if (((differs >> shift) & 0xFF) == 0)
+        {
+            continue;
+        }
 
-    // Swaps pointers, reassigns ownership
-    swap(head, origin.head);
-    swap(tail, origin.tail);
-    return;
+        run buckets[256] = {};
+
+        // Appending to the tail of each bucket keeps equal bytes in order
+        for (Node* node = head; node != nullptr; node = node->next)
+        {
+            note_hops();
+            run& bucket = buckets[(radix(node->data) >> shift) & 0xFF];
+
+            (bucket.head == nullptr ? bucket.head : bucket.tail->next) = node;
+            bucket.tail = node;
+        }
+
+        // Concatenate the buckets in ascending order
+        Node** link = &head;
+        for (run& bucket : buckets)
+        {
+            if (bucket.head != nullptr)
+            {
+                *link = bucket.head;
+                link = &bucket.tail->next;
+                tail = bucket.tail;
+            }
+        }
+        tail->next = nullptr;
+    }
 }
 
-template <typename T>
-void linear_linked_list<T>::throw_if_null(Node* node) const
+template <typename T, class Allocator>
+template <class Radix, class Key>
+bool linear_linked_list<T, Allocator>::gather_bucket_sort(Radix&& radix, Key differs)
 {
-    if(node)
+    struct keyed_node
     {
-        return;
-    }
+        Key key;
+        Node* node;
+    };
 
-    throw std::logic_error("Element access fail, null pointer");
-}
+    typedef typename std::allocator_traits<Allocator>::template 
+            rebind_alloc<keyed_node> keyed_allocator;
 
-/*******************************************************************************
-ITERATOR CLASS
-*******************************************************************************/
+    std::vector<keyed_node, keyed_allocator> nodes((keyed_allocator(alloc)));
+    std::vector<keyed_node, keyed_allocator> sorted((keyed_allocator(alloc)));
 
-/* Operator Overloads */
-template <typename T>
-typename linear_linked_list<T>::const_iterator& 
-linear_linked_list<T>::const_iterator::operator++()
-{
+    try
+    {
+        nodes.reserve(count);
+        sorted.resize(count);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+
+    // Count every byte of every key while gathering
+    size_type counts[sizeof(Key)][256] = {};
+
+    for (Node* node = head; node != nullptr; node = node->next)
+    {
+        note_hops();
+        Key key = radix(node->data);
+        nodes.push_back(keyed_node{ key, node });
+
+        for (size_type byte = 0; byte < sizeof(Key); ++byte)
+        {
+            ++counts[byte][(key >> (byte * 8)) & 0xFF];
+        }
+    }
+
+    for (size_type byte = 0; byte < sizeof(Key); ++byte)
+    {
+        if (((differs >> (byte * 8)) & 0xFF) == 0)
+        {
+            continue;
+        }
+
+        // Turn the counts into the offset of each bucket
+        size_type offset = 0;
+        for (size_type& bucket : counts[byte])
+        {
+            size_type size = bucket;
+            bucket = offset;
+            offset += size;
+        }
+
+        for (const keyed_node& item : nodes)
+        {
+            sorted[counts[byte][(item.key >> (byte * 8)) & 0xFF]++] = item;
+        }
+        nodes.swap(sorted);
+    }
+
+    // Relink the nodes in sorted order
+    for (size_type i = 0; i + 1 < nodes.size(); ++i)
+    {
+        // Sorted order scatters the writes, fetch the nodes ahead of them
+        if (prefetch_distance > 0 && i + prefetch_distance < nodes.size())
+        {
+            prefetch(nodes[i + prefetch_distance].node);
+        }
+        nodes[i].node->next = nodes[i + 1].node;
+    }
+
+    head = nodes.front().node;
+    tail = nodes.back().node;
+    tail->next = nullptr;
+
+    return true;
+}
+
+template <typename T, class Allocator>
+const typename linear_linked_list<T, Allocator>::size_type 
+linear_linked_list<T, Allocator>::parallel_grain;
+
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::parallel_sort(size_type threads)
+{
+    operation_scope scope(operation::parallel_sort);
+
+    return parallel_sort([](const T& lhs, const T& rhs){ return lhs < rhs; }, threads);
+}
+
+template <typename T, class Allocator>
+template <class Compare, class>
+linear_linked_list<T, Allocator>& 
+linear_linked_list<T, Allocator>::parallel_sort(Compare&& comp, size_type threads)
+{
+    operation_scope scope(operation::parallel_sort);
+
+    if (threads == 0)
+    {
+        threads = std::thread::hardware_concurrency();
+    }
+
+    // Each chunk must be worth the cost of starting a thread
+    threads = std::min(threads, count / parallel_grain);
+
+    if (threads < 2)
+    {
+        return sort(comp);
+    }
+
+    sort_strategy strategy = std::is_same<Allocator, std::allocator<T>>::value
+                           ? sort_strategy::automatic : sort_strategy::merge;
+
+    std::vector<self_type> chunks;
+    chunks.reserve(threads);
+
+    // Cut the list into chunks whose lengths differ by at most one
+    Node* current = head;
+    for (size_type i = 0; i < threads; ++i)
+    {
+        size_type length = count / threads + (i < count % threads ? 1 : 0);
+
+        chunks.emplace_back(get_allocator());
+        self_type& chunk = chunks.back();
+
+        chunk.head = current;
+        for (size_type j = 1; j < length; ++j)
+        {
+            current = current->next;
+            note_hops();
+        }
+        chunk.tail = current;
+        chunk.count = length;
+
+        current = current->next;
+        note_hops();
+        chunk.tail->next = nullptr;
+    }
+    head = tail = nullptr;
+    count = 0;
+
+    try
+    {
+        run_parallel(chunks.size(), [&](size_type i)
+        {
+            chunks[i].sort(comp, strategy);
+        });
+
+        // Each round merges every chunk with its neighbour step chunks away
+        for (size_type step = 1; step < chunks.size(); step *= 2)
+        {
+            size_type merges = (chunks.size() - step + 2 * step - 1) / (2 * step);
+
+            run_parallel(merges, [&](size_type i)
+            {
+                chunks[2 * step * i].merge(chunks[2 * step * i + step], comp);
+            });
+        }
+    }
+    catch (...)
+    {
+        // Give every node back to the list before rethrowing
+        for (self_type& chunk : chunks)
+        {
+            append(std::move(chunk));
+        }
+        throw;
+    }
+
+    return append(std::move(chunks.front()));
+}
+
+template <typename T, class Allocator>
+template <class Task>
+void linear_linked_list<T, Allocator>::run_parallel(size_type tasks, Task&& task)
+{
+    std::vector<std::exception_ptr> errors(tasks);
+    std::vector<std::thread> workers;
+    workers.reserve(tasks);
+
+    worker_hops hops(0);
+
+    auto guarded = [&](size_type i)
+    {
+        try
+        {
+            task(i);
+        }
+        catch (...)
+        {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    auto worker = [&](size_type i)
+    {
+        worker_scope scope(hops);
+        guarded(i);
+    };
+
+    for (size_type i = 1; i < tasks; ++i)
+    {
+        try
+        {
+            workers.emplace_back(worker, i);
+        }
+        catch (const std::system_error&)
+        {
+            // No thread could be started, run the task here instead
+            guarded(i);
+        }
+    }
+
+    // The calling thread takes the first task
+    guarded(0);
+
+    for (std::thread& thread : workers)
+    {
+        thread.join();
+    }
+    note_hops(hops);
+
+    for (std::exception_ptr& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+void linear_linked_list<T, Allocator>::sort_nodes(Compare&& comp, sort_strategy strategy, 
+                                                  bool stable)
+{
+    if(head == nullptr || head->next == nullptr)
+    {
+        return;
+    }
+
+    if (strategy == sort_strategy::automatic)
+    {
+        strategy = (count >= gather_threshold && !mostly_sorted(comp))
+                 ? sort_strategy::gather : sort_strategy::merge;
+    }
+
+    if (strategy == sort_strategy::gather && gather_sort(comp, stable))
+    {
+        return;
+    }
+
+    merge_sort(comp);
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+void linear_linked_list<T, Allocator>::merge_sort(Compare&& comp)
+{
+    // bins[i] holds a run merged from 2^i runs, or nothing
+    run bins[sort_levels] = {};
+    run carry = { nullptr, nullptr };
+    run sorted = { nullptr, nullptr };
+
+    // Every node is always in exactly one of the bins, carry, sorted or the
+    // unsorted chain at current, so a throwing comp loses none of them
+    Node* current = head;
+    try
+    {
+        while (current != nullptr)
+        {
+            carry = take_run(current, comp);
+
+            // Carry the run upward, earlier runs are always the left operand
+            size_type level = 0;
+            for (; level + 1 < sort_levels && bins[level].head != nullptr; ++level)
+            {
+                merge(bins[level], carry, comp);
+                carry = bins[level];
+                bins[level].head = nullptr;
+            }
+            bins[level] = carry;
+            carry.head = nullptr;
+        }
+
+        // Higher bins hold earlier elements, fold them in from the lowest bin up
+        for (size_type level = 0; level < sort_levels; ++level)
+        {
+            if (bins[level].head != nullptr)
+            {
+                merge(bins[level], sorted, comp);
+                sorted = bins[level];
+                bins[level].head = nullptr;
+            }
+        }
+    }
+    catch (...)
+    {
+        // Chain the pieces back together in no particular order
+        run whole = { current, current };
+        while (whole.tail != nullptr && whole.tail->next != nullptr)
+        {
+            whole.tail = whole.tail->next;
+        }
+
+        link_runs(whole, carry);
+        link_runs(whole, sorted);
+        for (run& bin : bins)
+        {
+            link_runs(whole, bin);
+        }
+
+        head = whole.head;
+        tail = whole.tail;
+        throw;
+    }
+
+    head = sorted.head;
+    tail = sorted.tail;
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+bool linear_linked_list<T, Allocator>::gather_sort(Compare&& comp, bool stable)
+{
+    typedef typename std::allocator_traits<Allocator>::template 
+            rebind_alloc<Node*> pointer_allocator;
+
+    std::vector<Node*, pointer_allocator> nodes((pointer_allocator(alloc)));
+
+    try
+    {
+        nodes.reserve(count);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+
+    for (Node* node = head; node != nullptr; node = node->next)
+    {
+        note_hops();
+        nodes.push_back(node);
+    }
+
+    auto less = [&comp](const Node* lhs, const Node* rhs)
+    {
+        return comp(lhs->data, rhs->data);
+    };
+
+    if (stable)
+    {
+        std::stable_sort(nodes.begin(), nodes.end(), less);
+    }
+    else
+    {
+        std::sort(nodes.begin(), nodes.end(), less);
+    }
+
+    // Relink the nodes in sorted order
+    for (size_type i = 0; i + 1 < nodes.size(); ++i)
+    {
+        // Sorted order scatters the writes, fetch the nodes ahead of them
+        if (prefetch_distance > 0 && i + prefetch_distance < nodes.size())
+        {
+            prefetch(nodes[i + prefetch_distance]);
+        }
+        nodes[i]->next = nodes[i + 1];
+    }
+
+    head = nodes.front();
+    tail = nodes.back();
+    tail->next = nullptr;
+
+    return true;
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+bool linear_linked_list<T, Allocator>::mostly_sorted(Compare&& comp) const
+{
+    size_type runs = 1;
+    size_type limit = count / 64;
+
+    for (Node* node = head; node->next != nullptr; ++runs)
+    {
+        if (runs > limit)
+        {
+            return false;
+        }
+
+        // Walk to the last node of this ascending or strictly descending run
+        bool descending = comp(node->next->data, node->data);
+        while (node->next != nullptr 
+               && comp(node->next->data, node->data) == descending)
+        {
+            node = node->next;
+            note_hops();
+        }
+
+        if (node->next == nullptr)
+        {
+            break;
+        }
+        node = node->next;
+        note_hops();
+    }
+
+    return runs <= limit;
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+typename linear_linked_list<T, Allocator>::run
+linear_linked_list<T, Allocator>::take_run(Node*& current, Compare&& comp)
+{
+    run taken = { current, current };
+    Node* next = current->next;
+
+    try
+    {
+        if (next != nullptr && comp(next->data, current->data))
+        {
+            // Strictly descending, push each node onto the front of the run
+            while (next != nullptr && comp(next->data, taken.head->data))
+            {
+                Node* after = next->next;
+                next->next = taken.head;
+                taken.head = next;
+                next = after;
+                note_hops();
+            }
+        }
+        else
+        {
+            while (next != nullptr && !comp(next->data, taken.tail->data))
+            {
+                taken.tail = next;
+                next = next->next;
+                note_hops();
+            }
+        }
+    }
+    catch (...)
+    {
+        // Until the run is cut off its tail still links to the first node of
+        // a descending run. Link it to the rest of the chain instead, which
+        // leaves the reversed nodes in front of the unsorted ones
+        taken.tail->next = next;
+        current = taken.head;
+        throw;
+    }
+
+    taken.tail->next = nullptr;
+    current = next;
+
+    return taken;
+}
+
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator> linear_linked_list<T, Allocator>::split(const_iterator pos)
+{
+    operation_scope scope(operation::split);
+
+    linear_linked_list<T, Allocator> temp(get_allocator());
+
+    if(pos.node != nullptr)
+    {
+        temp.head = pos.node->next;
+        temp.tail = (temp.head == nullptr) ? nullptr : tail;
+
+        // Only the split off nodes are counted
+        temp.count = size(temp.head);
+        count -= temp.count;
+        temp.note_held();
+
+        tail = pos.node;
+        tail->next = nullptr;
+    }
+    return temp;
+}
+
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::merge(self_type& list)
+{
+    operation_scope scope(operation::merge);
+
+    return merge(list, [](const T& lhs, const T& rhs){ return lhs < rhs; });
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::merge(self_type& list, Compare&& comp)
+{
+    operation_scope scope(operation::merge);
+
+    if(&list != this)
+    {
+        run merged = { head, tail };
+        run other = { list.head, list.tail };
+
+        // Whether or not comp throws, every node of both lists ends up here
+        try
+        {
+            merge(merged, other, comp);
+        }
+        catch (...)
+        {
+            adopt_merged(merged, list);
+            throw;
+        }
+
+        adopt_merged(merged, list);
+    }
+    return *this;
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::adopt_merged(run merged, self_type& list)
+{
+    head = merged.head;
+    tail = merged.tail;
+
+    count += list.count;
+    note_held();
+
+    // Merge does not copy, source must relinquish resources
+    list.head = list.tail = nullptr;
+    list.count = 0;
+}
+
+template <typename T, class Allocator>
+template <class Compare>
+void linear_linked_list<T, Allocator>::merge(run& self, run& other, Compare&& comp)
+{
+    if (other.head == nullptr)
+    {
+        return;
+    }
+
+    run merged = { nullptr, nullptr };
+
+    // link always points at the next pointer to be filled in
+    Node** link = &merged.head;
+
+    // Each run is prefetched ahead of its own head
+    lookahead self_ahead(self.head, prefetch_distance);
+    lookahead other_ahead(other.head, prefetch_distance);
+
+    try
+    {
+        while (self.head != nullptr && other.head != nullptr)
+        {
+            // Ties take from self, so equal elements keep their order
+            if (comp(other.head->data, self.head->data))
+            {
+                *link = other.head;
+                other.head = other.head->next;
+                other_ahead.advance();
+            }
+            else
+            {
+                *link = self.head;
+                self.head = self.head->next;
+                self_ahead.advance();
+            }
+            link = &(*link)->next;
+            note_hops();
+        }
+    }
+    catch (...)
+    {
+        // comp is only called while both runs have nodes left, chain the
+        // remainders after the merged nodes so that none is lost
+        *link = self.head;
+        self.tail->next = other.head;
+        self.head = merged.head;
+        self.tail = other.tail;
+        other.head = other.tail = nullptr;
+        throw;
+    }
+
+    // One run is exhausted, append the remainder of the non-empty run
+    if (self.head != nullptr)
+    {
+        *link = self.head;
+        merged.tail = self.tail;
+    }
+    else
+    {
+        *link = other.head;
+        merged.tail = other.tail;
+    }
+
+    self = merged;
+    other.head = other.tail = nullptr;
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::link_runs(run& self, run other)
+{
+    if (other.head == nullptr)
+    {
+        return;
+    }
+
+    if (self.head == nullptr)
+    {
+        self = other;
+    }
+    else
+    {
+        self.tail->next = other.head;
+        self.tail = other.tail;
+    }
+}
+
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& 
+linear_linked_list<T, Allocator>::splice_after(const_iterator pos, self_type& other)
+{
+    operation_scope scope(operation::splice_after);
+
+    throw_if_null(pos.node);
+
+    if (&other == this || other.empty())
+    {
+        return *this;
+    }
+
+    other.tail->next = pos.node->next;
+    pos.node->next = other.head;
+
+    if (tail == pos.node)
+    {
+        tail = other.tail;
+    }
+
+    count += other.count;
+    note_held();
+
+    // Splice does not copy, source must relinquish resources
+    other.head = other.tail = nullptr;
+    other.count = 0;
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& 
+linear_linked_list<T, Allocator>::splice_after(const_iterator pos, self_type& other,
+                                               const_iterator first, const_iterator last)
+{
+    operation_scope scope(operation::splice_after);
+
+    throw_if_null(pos.node);
+    throw_if_null(first.node);
+    throw_if_null(last.node);
+
+    // The range is empty, or would be spliced after its own first node
+    if (first == last || pos == first)
+    {
+        return *this;
+    }
+
+    // Unlink (first, last] from other
+    Node* begin = first.node->next;
+    first.node->next = last.node->next;
+    last.node->next = nullptr;
+
+    // The range has to be counted when it moves between lists
+    if (&other != this)
+    {
+        size_type moved = size(begin);
+        other.count -= moved;
+        count += moved;
+        note_held();
+    }
+
+    if (other.tail == last.node)
+    {
+        other.tail = first.node;
+    }
+
+    // Link the range after pos
+    last.node->next = pos.node->next;
+    pos.node->next = begin;
+
+    if (tail == pos.node)
+    {
+        tail = last.node;
+    }
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& 
+linear_linked_list<T, Allocator>::append(self_type&& other)
+{
+    if (&other == this || other.empty())
+    {
+        return *this;
+    }
+
+    if (empty())
+    {
+        head = other.head;
+    }
+    else
+    {
+        tail->next = other.head;
+    }
+    tail = other.tail;
+    count += other.count;
+    note_held();
+
+    other.head = other.tail = nullptr;
+    other.count = 0;
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& 
+linear_linked_list<T, Allocator>::prepend(self_type&& other)
+{
+    if (&other == this || other.empty())
+    {
+        return *this;
+    }
+
+    if (empty())
+    {
+        tail = other.tail;
+    }
+    else
+    {
+        other.tail->next = head;
+    }
+    head = other.head;
+    count += other.count;
+    note_held();
+
+    other.head = other.tail = nullptr;
+    other.count = 0;
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::iterator
+linear_linked_list<T, Allocator>::erase_after(iterator pos)
+{
+    if(pos.node != nullptr && pos.node != tail)
+    {
+        Node* temp = pos.node->next;
+        pos.node->next = temp->next;
+
+        // Edge case : element to be removed is the tail
+        if (temp == tail)
+        {
+            tail = pos.node;
+        }
+
+        destroy_node(temp);
+    }
+    return pos;
+}
+
+template <typename T, class Allocator>
+int linear_linked_list<T, Allocator>::remove(const_reference target)
+{
+    operation_scope scope(operation::remove);
+
+    // lambda catches target and compares it to each element in the list
+    return remove_if([&target](T& sample){ return target == sample; });
+}
+
+template <typename T, class Allocator>
+template <class Predicate>
+int linear_linked_list<T, Allocator>::remove_if(Predicate&& pred)
+{
+    operation_scope scope(operation::remove_if);
+
+    if (empty())
+    {
+        return 0;
+    }
+    
+    return remove_if(pred, head);
+}
+
+template <typename T, class Allocator>
+template <class Predicate>
+int linear_linked_list<T, Allocator>::remove_if(Predicate&& pred, Node*& current, Node* prev)
+{
+    int removed = 0;
+
+    // link always points at the pointer that refers to the node under test
+    Node** link = &current;
+    lookahead ahead(current, prefetch_distance);
+
+    while(*link != nullptr)
+    {
+        Node* node = *link;
+        ahead.advance();
+
+        // Predicate fulfilled, unlink and remove this element
+        if(pred(node->data))
+        {
+            // Edge case : element to be removed is the tail. 
+            if (tail == node)
+            {
+                tail = prev;
+            }
+
+            *link = node->next;
+            note_hops();
+
+            destroy_node(node);
+
+            ++removed;
+        }
+        else
+        {
+            prev = node;
+            link = &node->next;
+            note_hops();
+        }
+    }
+
+    return removed;
+}
+
+/****** CAPACITY ******/
+
+template <typename T, class Allocator>
+bool linear_linked_list<T, Allocator>::empty() const
+{
+    return !(head);
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::size_type linear_linked_list<T, Allocator>::size() const
+{
+    return count;
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::size_type linear_linked_list<T, Allocator>::size(Node* head) const
+{
+    size_type count = 0;
+
+    for (; head != nullptr; head = head->next)
+    {
+        note_hops();
+        ++count;
+    }
+
+    return count;
+}
+
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::reserve(size_type n)
+{
+    if (pool_capacity < n)
+    {
+        pool_capacity = n;
+    }
+
+    while (pool_size < n)
+    {
+        Node* node = node_traits::allocate(alloc, 1);
+        node->next = pool;
+        pool = node;
+        ++pool_size;
+        note_allocated(1);
+    }
+
+    note_held();
+    return *this;
+}
+
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>& linear_linked_list<T, Allocator>::shrink_to_fit()
+{
+    pool_capacity = 0;
+
+    release_pool();
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::reserve_thread_cache(size_type n)
+{
+    static_assert(shares_nodes::value, 
+                  "the thread cache requires a stateless allocator");
+
+    // A thread that is exiting has no cache left to fill
+    if (thread_cache_state() == cache_state::destroyed)
+    {
+        return;
+    }
+
+    node_cache& cache = thread_cache();
+    thread_cache_state() = cache_state::on;
+
+    if (cache.capacity < n)
+    {
+        cache.capacity = n;
+    }
+
+    node_allocator alloc;
+    while (cache.size < n)
+    {
+        Node* node = node_traits::allocate(alloc, 1);
+        node->next = cache.nodes;
+        cache.nodes = node;
+        ++cache.size;
+        note_type_allocated(1);
+    }
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::release_thread_cache()
+{
+    static_assert(shares_nodes::value, 
+                  "the thread cache requires a stateless allocator");
+
+    if (thread_cache_state() != cache_state::on)
+    {
+        return;
+    }
+
+    node_cache& cache = thread_cache();
+
+    cache.release();
+    cache.capacity = 0;
+    thread_cache_state() = cache_state::off;
+}
+
+/****** ELEMENT ACCESS ******/
+
+template <typename T, class Allocator>
+T& linear_linked_list<T, Allocator>::front() 
+{
+    throw_if_null(head);
+
+    return head->data;
+}
+
+template <typename T, class Allocator>
+const T& linear_linked_list<T, Allocator>::front() const
+{
+    throw_if_null(head);
+
+    return head->data;
+}
+
+template <typename T, class Allocator>
+T& linear_linked_list<T, Allocator>::back() 
+{
+    throw_if_null(tail);
+
+    return tail->data;
+}
+
+template <typename T, class Allocator>
+const T& linear_linked_list<T, Allocator>::back() const
+{
+    throw_if_null(tail);
+
+    return tail->data;
+}
+
+/****** ITERATORS ******/
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::iterator
+linear_linked_list<T, Allocator>::begin()
+{
+    return iterator(head);
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::const_iterator 
+linear_linked_list<T, Allocator>::begin() const
+{
+    return const_iterator(head);
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::iterator
+linear_linked_list<T, Allocator>::end()
+{
+    return iterator(nullptr);
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::const_iterator 
+linear_linked_list<T, Allocator>::end() const
+{
+    return const_iterator(nullptr);
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::iterator 
+linear_linked_list<T, Allocator>::middle()
+{
+    operation_scope scope(operation::middle);
+
+    return iterator(middle(head));
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::const_iterator 
+linear_linked_list<T, Allocator>::middle() const
+{
+    operation_scope scope(operation::middle);
+
+    return const_iterator(middle(head));
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::Node* 
+linear_linked_list<T, Allocator>::middle(Node* head) const
+{
+    if(head == nullptr || head->next == nullptr)
+    {
+        return head;
+    }
+
+    return middle(head, head->next);
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::Node* 
+linear_linked_list<T, Allocator>::middle(Node* slow, Node* fast) const
+{
+    // fast advances two nodes for every one node slow advances
+    while (fast != nullptr && (fast = fast->next) != nullptr)
+    {
+        slow = slow->next;
+        fast = fast->next;
+        note_hops(3);
+    }
+
+    return slow;
+}
+
+/****** TRAVERSAL ******/
+
+template <typename T, class Allocator>
+const typename linear_linked_list<T, Allocator>::size_type 
+linear_linked_list<T, Allocator>::prefetch_distance;
+
+template <typename T, class Allocator>
+template <class Function>
+Function linear_linked_list<T, Allocator>::for_each(Function f, size_type distance)
+{
+    lookahead ahead(head, distance);
+
+    for (Node* node = head; node != nullptr; node = node->next)
+    {
+        ahead.advance();
+        f(node->data);
+    }
+
+    return f;
+}
+
+template <typename T, class Allocator>
+template <class Function>
+Function linear_linked_list<T, Allocator>::for_each(Function f, size_type distance) const
+{
+    lookahead ahead(head, distance);
+
+    for (const Node* node = head; node != nullptr; node = node->next)
+    {
+        ahead.advance();
+        f(static_cast<const_reference>(node->data));
+    }
+
+    return f;
+}
+
+template <typename T, class Allocator>
+template <typename U, class BinaryOperation>
+U linear_linked_list<T, Allocator>::accumulate(U init, BinaryOperation op, 
+                                               size_type distance) const
+{
+    lookahead ahead(head, distance);
+
+    for (const Node* node = head; node != nullptr; node = node->next)
+    {
+        ahead.advance();
+        init = op(std::move(init), node->data);
+    }
+
+    return init;
+}
+
+template <typename T, class Allocator>
+const typename linear_linked_list<T, Allocator>::size_type 
+linear_linked_list<T, Allocator>::operation_count;
+
+#ifdef LINKED_LIST_STATISTICS
+
+/****** STATISTICS ******/
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::statistics
+linear_linked_list<T, Allocator>::stats() const
+{
+    return statistics{ nodes_allocated, nodes_freed, count + pool_size, 
+                       peak_live_nodes, sizeof(Node) };
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::statistics
+linear_linked_list<T, Allocator>::type_stats()
+{
+    const type_counters& totals = type_totals();
+
+    // Read freed first, so that a concurrent allocation cannot make live negative
+    const size_type freed = totals.freed.load();
+    const size_type allocated = totals.allocated.load();
+
+    return statistics{ allocated, freed, allocated - freed, 
+                       totals.peak_live.load(), sizeof(Node) };
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::type_counters&
+linear_linked_list<T, Allocator>::type_totals()
+{
+    // Constant initialized, so lists with static storage can count safely
+    static type_counters totals{ {0}, {0}, {0} };
+    return totals;
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::note_allocated(size_type n)
+{
+    nodes_allocated += n;
+    note_type_allocated(n);
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::note_freed(size_type n)
+{
+    nodes_freed += n;
+    note_type_freed(n);
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::note_type_allocated(size_type n)
+{
+    type_counters& totals = type_totals();
+
+    const size_type live = totals.allocated.fetch_add(n, std::memory_order_relaxed) + n
+                         - totals.freed.load(std::memory_order_relaxed);
+
+    size_type peak = totals.peak_live.load(std::memory_order_relaxed);
+    while (peak < live 
+           && !totals.peak_live.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+    {
+    }
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::note_type_freed(size_type n)
+{
+    type_totals().freed.fetch_add(n, std::memory_order_relaxed);
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::note_held()
+{
+    peak_live_nodes = std::max(peak_live_nodes, count + pool_size);
+}
+
+#endif // LINKED_LIST_STATISTICS
+
+#ifdef LINKED_LIST_PROFILING
+
+/****** PROFILING ******/
+
+template <typename T, class Allocator>
+const typename linear_linked_list<T, Allocator>::size_type 
+linear_linked_list<T, Allocator>::hop_buckets;
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::operation_profile
+linear_linked_list<T, Allocator>::profile(operation op)
+{
+    const profile_counters& counters = profiles()[static_cast<size_type>(op)];
+
+    operation_profile totals;
+    totals.calls = counters.calls.load();
+    totals.hops = counters.hops.load();
+    for (size_type i = 0; i < hop_buckets; ++i)
+    {
+        totals.histogram[i] = counters.histogram[i].load();
+    }
+
+    return totals;
+}
+
+template <typename T, class Allocator>
+const char* linear_linked_list<T, Allocator>::operation_name(operation op)
+{
+    static const char* const names[operation_count] = {
+        "copy", "assign", "clear", "reverse", "sort", "stable_sort", "sort_by",
+        "sort_by_key", "parallel_sort", "merge", "split", "splice_after", 
+        "remove", "remove_if", "middle", "equality"
+    };
+
+    return names[static_cast<size_type>(op)];
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::reset_profile()
+{
+    for (size_type op = 0; op < operation_count; ++op)
+    {
+        profile_counters& counters = profiles()[op];
+
+        counters.calls.store(0);
+        counters.hops.store(0);
+        for (size_type i = 0; i < hop_buckets; ++i)
+        {
+            counters.histogram[i].store(0);
+        }
+    }
+}
+
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>::operation_scope::operation_scope(operation op)
+    : op(op), start(thread_hops().hops), outermost(thread_hops().depth++ == 0) {}
+
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>::operation_scope::~operation_scope()
+{
+    hop_counter& counter = thread_hops();
+    --counter.depth;
+
+    if (!outermost)
+    {
+        return;
+    }
+
+    const size_type hops = counter.hops - start;
+
+    // Bucket b holds calls of 2^(b-1) to 2^b - 1 hops
+    size_type bucket = 0;
+    for (size_type rest = hops; rest != 0 && bucket + 1 < hop_buckets; rest >>= 1)
+    {
+        ++bucket;
+    }
+
+    profile_counters& counters = profiles()[static_cast<size_type>(op)];
+    counters.calls.fetch_add(1, std::memory_order_relaxed);
+    counters.hops.fetch_add(hops, std::memory_order_relaxed);
+    counters.histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>::worker_scope::worker_scope(std::atomic<size_type>& total)
+    : total(total), start(thread_hops().hops)
+{
+    // Not outermost, so the task's operations are not recorded on their own
+    ++thread_hops().depth;
+}
+
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>::worker_scope::~worker_scope()
+{
+    hop_counter& counter = thread_hops();
+    --counter.depth;
+    total.fetch_add(counter.hops - start, std::memory_order_relaxed);
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::profile_counters*
+linear_linked_list<T, Allocator>::profiles()
+{
+    // Static storage is zeroed before any list can be profiled
+    static profile_counters counters[operation_count];
+    return counters;
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::hop_counter&
+linear_linked_list<T, Allocator>::thread_hops()
+{
+    static thread_local hop_counter counter = { 0, 0 };
+    return counter;
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::note_hops(size_type n)
+{
+    thread_hops().hops += n;
+}
+
+#endif // LINKED_LIST_PROFILING
+
+/****** ALLOCATOR ******/
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::allocator_type
+linear_linked_list<T, Allocator>::get_allocator() const
+{
+    return allocator_type(alloc);
+}
+
+/****** COMPARISON OPERATORS ******/
+
+template <typename T, class Allocator>
+bool linear_linked_list<T, Allocator>::operator==(const self_type& rhs) const
+{
+    operation_scope scope(operation::equality);
+
+    // Compare sizes first
+    if (rhs.size() != size())
+    {
+        return false;
+    }
+
+    const_iterator left = begin();
+    const_iterator right = rhs.begin();
+
+    while(left != end() && right != rhs.end())
+    {
+        // If any element does not match then return false
+        if (*(left++) != *(right++))
+        {
+            return false;
+        }
+    }
+
+    return true; // TODO test left and right are both end iterators
+}
+
+template <typename T, class Allocator>
+bool linear_linked_list<T, Allocator>::operator!=(const self_type& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::self_type& 
+linear_linked_list<T, Allocator>::operator=(const self_type& origin)
+{
+    operation_scope scope(operation::copy);
+
+    if (this == &origin)
+    {
+        return *this;
+    }
+
+    if (node_traits::propagate_on_container_copy_assignment::value)
+    {
+        if (alloc != origin.alloc)
+        {
+            // The nodes must be freed by the old allocator, so build a copy
+            // with the new allocator and swap ownership of resources with it
+            self_type copy(origin, origin.get_allocator());
+            swap_all(copy);
+
+            // As the copy goes out of scope it destructs with the old data
+            return *this;
+        }
+
+        // Equal allocators can free each other's nodes
+        alloc = origin.alloc;
+    }
+
+    assign_copies(origin.begin(), origin.count);
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::self_type& 
+linear_linked_list<T, Allocator>::operator=(self_type&& origin)
+{
+    if (this == &origin)
+    {
+        return *this;
+    }
+
+    clear();
+
+    if (node_traits::propagate_on_container_move_assignment::value)
+    {
+        swap_all(origin);
+    }
+    else if (alloc == origin.alloc)
+    {
+        swap(origin);
+    }
+    else
+    {
+        // Nodes cannot be freed by a different allocator, move each element
+        for (reference element : origin)
+        {
+            push_back(std::move(element));
+        }
+        origin.clear();
+    }
+
+    return *this;
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::swap(self_type& origin)
+{
+    using std::swap;
+
+    if (node_traits::propagate_on_container_swap::value)
+    {
+        // The pooled nodes must be freed by the allocator that made them
+        swap(alloc, origin.alloc);
+        swap_pool(origin);
+    }
+
+    // Swaps pointers, reassigns ownership
+    swap(head, origin.head);
+    swap(tail, origin.tail);
+    swap(count, origin.count);
+    note_held();
+    origin.note_held();
+    return;
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::swap_all(self_type& origin)
+{
+    using std::swap;
+
+    swap(alloc, origin.alloc);
+    swap(head, origin.head);
+    swap(tail, origin.tail);
+    swap(count, origin.count);
+    swap_pool(origin);
+    note_held();
+    origin.note_held();
+    return;
+}
+
+template <typename T, class Allocator>
+template <class... Args>
+typename linear_linked_list<T, Allocator>::Node*
+linear_linked_list<T, Allocator>::create_node(Node* next, Args&&... args)
+{
+    Node* node = take_spare_node();
+
+    // Reuse a spare node, only the data needs to be constructed
+    if (node != nullptr)
+    {
+        try
+        {
+            node_traits::construct(alloc, std::addressof(node->data), 
+                                   std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            recycle_node(node);
+            throw;
+        }
+
+        node->next = next;
+        ++count;
+        note_held();
+        return node;
+    }
+
+    node = node_traits::allocate(alloc, 1);
+    note_allocated(1);
+
+    try
+    {
+        node_traits::construct(alloc, node, next, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        // Construction failed, release the memory before rethrowing
+        node_traits::deallocate(alloc, node, 1);
+        note_freed(1);
+        throw;
+    }
+
+    ++count;
+    note_held();
+    return node;
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::destroy_node(Node* node)
+{
+    node_traits::destroy(alloc, std::addressof(node->data));
+    --count;
+
+    recycle_node(node);
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::recycle_node(Node* node)
+{
+    if (pool_size < pool_capacity)
+    {
+        // Keep the memory, the node's next pointer links it into the pool
+        node->next = pool;
+        pool = node;
+        ++pool_size;
+        note_held();
+        return;
+    }
+
+    if (cache_room(shares_nodes()) > 0)
+    {
+        cache_nodes(node, node, 1, shares_nodes());
+        return;
+    }
+
+    node_traits::deallocate(alloc, node, 1);
+    note_freed(1);
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::Node*
+linear_linked_list<T, Allocator>::take_spare_node()
+{
+    if (pool == nullptr)
+    {
+        return take_cached_node(shares_nodes());
+    }
+
+    Node* node = pool;
+    pool = node->next;
+    --pool_size;
+
+    return node;
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::release_pool()
+{
+    // Hand as many pooled nodes to the thread cache as it has room for
+    const size_type cached = std::min(cache_room(shares_nodes()), pool_size);
+
+    if (cached > 0)
+    {
+        Node* first = pool;
+        Node* last = pool;
+        for (size_type i = 1; i < cached; ++i)
+        {
+            last = last->next;
+        }
+        pool = last->next;
+
+        cache_nodes(first, last, cached, shares_nodes());
+    }
+
+    // Whatever is not cached is freed, or dropped when freeing does nothing
+    note_freed(pool_size - cached);
+
+    if (deallocation_is_noop(alloc))
+    {
+        pool = nullptr;
+    }
+
+    while (pool != nullptr)
+    {
+        // Pooled data is already destroyed, only the memory is left to free
+        Node* temp = pool->next;
+        node_traits::deallocate(alloc, pool, 1);
+        pool = temp;
+    }
+
+    pool_size = 0;
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::node_cache&
+linear_linked_list<T, Allocator>::thread_cache()
+{
+    static thread_local node_cache cache;
+    return cache;
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::cache_state&
+linear_linked_list<T, Allocator>::thread_cache_state()
+{
+    static thread_local cache_state state = cache_state::off;
+    return state;
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::Node*
+linear_linked_list<T, Allocator>::take_cached_node(std::true_type)
+{
+    if (thread_cache_state() != cache_state::on)
+    {
+        return nullptr;
+    }
+
+    node_cache& cache = thread_cache();
+
+    Node* node = cache.nodes;
+    if (node != nullptr)
+    {
+        cache.nodes = node->next;
+        --cache.size;
+    }
+
+    return node;
+}
+
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::size_type
+linear_linked_list<T, Allocator>::cache_room(std::true_type)
+{
+    // Threads that never opted in do not touch, or construct, the cache
+    if (thread_cache_state() != cache_state::on)
+    {
+        return 0;
+    }
+
+    const node_cache& cache = thread_cache();
+
+    return cache.capacity - cache.size;
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::cache_nodes(Node* first, Node* last, 
+                                                   size_type count, std::true_type)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    node_cache& cache = thread_cache();
+
+    last->next = cache.nodes;
+    cache.nodes = first;
+    cache.size += count;
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::node_cache::release()
+{
+    // Stateless allocators can free memory obtained from any other instance
+    node_allocator alloc;
+
+    while (nodes != nullptr)
+    {
+        Node* temp = nodes->next;
+        node_traits::deallocate(alloc, nodes, 1);
+        note_type_freed(1);
+        nodes = temp;
+    }
+
+    size = 0;
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::prefetch(const Node* node)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(node);
+#else
+    (void)node;
+#endif
+}
+
+template <typename T, class Allocator>
+linear_linked_list<T, Allocator>::lookahead::lookahead(const Node* start, size_type distance)
+    : ahead(distance > 0 ? start : nullptr)
+{
+    // Walks out to the distance, prefetching the nodes in between
+    for (size_type i = 0; i < distance && ahead != nullptr; ++i)
+    {
+        ahead = ahead->next;
+        prefetch(ahead);
+    }
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::lookahead::advance()
+{
+    if (ahead != nullptr)
+    {
+        ahead = ahead->next;
+        prefetch(ahead);
+    }
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::swap_pool(self_type& origin)
+{
+    using std::swap;
+
+    swap(pool, origin.pool);
+    swap(pool_size, origin.pool_size);
+    swap(pool_capacity, origin.pool_capacity);
+    return;
+}
+
+template <typename T, class Allocator>
+void linear_linked_list<T, Allocator>::throw_if_null(Node* node) const
+{
+    if(node)
+    {
+        return;
+    }
+
+    throw std::logic_error("Element access fail, null pointer");
+}
+
+/*******************************************************************************
+ITERATOR CLASS
+*******************************************************************************/
+
+/* Operator Overloads */
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::const_iterator& 
+linear_linked_list<T, Allocator>::const_iterator::operator++()
+{
     // reassign node member to point to the next element in the container
     node = node->next;
+    note_hops();
+
+    // An iterator has no room to look further ahead than the next node
+    if (prefetch_distance > 0 && node != nullptr)
+    {
+        prefetch(node->next);
+    }
     return *this;
 }
 
-template <typename T>
-typename linear_linked_list<T>::const_iterator
-linear_linked_list<T>::const_iterator::operator++(int)
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::const_iterator
+linear_linked_list<T, Allocator>::const_iterator::operator++(int)
 {
     // Create a copy to satisfy postfix incrementation requirements
     self_type copy = self_type(*this);
@@ -578,43 +2558,43 @@ linear_linked_list<T>::const_iterator::operator++(int)
     return copy;
 }
 
-template <typename T>
-bool linear_linked_list<T>::const_iterator::operator==(const self_type& rhs) const
+template <typename T, class Allocator>
+bool linear_linked_list<T, Allocator>::const_iterator::operator==(const self_type& rhs) const
 {
     // Iterators are equal if they point to the same memory address
     return node == rhs.node;
 }
 
-template <typename T>
-bool linear_linked_list<T>::const_iterator::operator!=(const self_type& rhs) const
+template <typename T, class Allocator>
+bool linear_linked_list<T, Allocator>::const_iterator::operator!=(const self_type& rhs) const
 {
     return !(*this == rhs);
 }
 
-template <typename T>
-typename linear_linked_list<T>::const_reference 
-linear_linked_list<T>::const_iterator::operator*() const
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::const_reference 
+linear_linked_list<T, Allocator>::const_iterator::operator*() const
 {
     return node->data;
 }
 
-template <typename T>
-typename linear_linked_list<T>::const_pointer
-linear_linked_list<T>::const_iterator::operator->() const
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::const_pointer
+linear_linked_list<T, Allocator>::const_iterator::operator->() const
 {
     return &node->data;
 }
 
-template <typename T>
-typename linear_linked_list<T>::reference
-linear_linked_list<T>::iterator::operator*() 
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::reference
+linear_linked_list<T, Allocator>::iterator::operator*() 
 {
     return this->node->data;
 }
 
-template <typename T>
-typename linear_linked_list<T>::pointer
-linear_linked_list<T>::iterator::operator->()
+template <typename T, class Allocator>
+typename linear_linked_list<T, Allocator>::pointer
+linear_linked_list<T, Allocator>::iterator::operator->()
 {
     return &this->node->data;
 }
@@ -0,0 +1,939 @@
+/*
+
+ File: unrolled_linked_list.cpp
+
+ Brief: Implementation file for the unrolled_linked_list data structure
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef UNROLLED_LINKED_LIST_CPP
+#define UNROLLED_LINKED_LIST_CPP
+
+#include "unrolled_linked_list.hpp"
+
+/****** CONSTRUCTORS ******/
+
+// default constructor
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>::unrolled_linked_list()
+    : head(nullptr), tail(nullptr), alloc() {}
+
+// allocator constructor
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>::unrolled_linked_list(const allocator_type& alloc)
+    : head(nullptr), tail(nullptr), alloc(alloc) {}
+
+// ranged based constructor
+template <typename T, std::size_t K, class Allocator>
+template <class InputIterator>
+unrolled_linked_list<T, K, Allocator>::unrolled_linked_list(InputIterator begin,
+                                                            InputIterator end,
+                                                            const allocator_type& alloc)
+    : unrolled_linked_list(alloc)
+{
+    for(; begin != end; ++begin)
+    {
+        push_back(*begin);
+    }
+}
+
+// Initializer List
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>::unrolled_linked_list(std::initializer_list<value_type> init,
+                                                            const allocator_type& alloc)
+    : unrolled_linked_list(alloc)
+{
+    for (const_reference element : init)
+    {
+        push_back(element);
+    }
+}
+
+// Copy constructor
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>::unrolled_linked_list(const self_type& origin)
+    : unrolled_linked_list(
+        std::allocator_traits<Allocator>::select_on_container_copy_construction(
+            origin.get_allocator()))
+{
+    for (const_reference element : origin)
+    {
+        push_back(element);
+    }
+}
+
+// Move constructor
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>::unrolled_linked_list(self_type&& origin)
+    : head(nullptr), tail(nullptr), alloc(std::move(origin.alloc))
+{
+    std::swap(head, origin.head);
+    std::swap(tail, origin.tail);
+}
+
+// Destructor
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>::~unrolled_linked_list()
+{
+    clear();
+}
+
+/****** MODIFIERS ******/
+
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>&
+unrolled_linked_list<T, K, Allocator>::push_front(const_reference data)
+{
+    construct_front(data);
+    return *this;
+}
+
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>&
+unrolled_linked_list<T, K, Allocator>::push_front(T&& data)
+{
+    construct_front(std::forward<T>(data));
+    return *this;
+}
+
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>&
+unrolled_linked_list<T, K, Allocator>::push_back(const_reference data)
+{
+    construct_back(data);
+    return *this;
+}
+
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>&
+unrolled_linked_list<T, K, Allocator>::push_back(T&& data)
+{
+    construct_back(std::forward<T>(data));
+    return *this;
+}
+
+template <typename T, std::size_t K, class Allocator>
+template <class... Args>
+void unrolled_linked_list<T, K, Allocator>::construct_front(Args&&... args)
+{
+    // There is room before the head's first element
+    if (head != nullptr && head->first > 0)
+    {
+        node_traits::construct(alloc, head->elements() + head->first - 1,
+                               std::forward<Args>(args)...);
+        --head->first;
+        return;
+    }
+
+    // New front nodes fill from the back so later pushes need no shifting
+    Node* node = create_node(head, K);
+
+    try
+    {
+        node_traits::construct(alloc, node->elements() + K - 1,
+                               std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        deallocate_node(node);
+        throw;
+    }
+
+    --node->first;
+
+    head = node;
+
+    if (tail == nullptr)
+    {
+        tail = head;
+    }
+}
+
+template <typename T, std::size_t K, class Allocator>
+template <class... Args>
+void unrolled_linked_list<T, K, Allocator>::construct_back(Args&&... args)
+{
+    // There is room after the tail's last element
+    if (tail != nullptr && tail->last < K)
+    {
+        node_traits::construct(alloc, tail->elements() + tail->last,
+                               std::forward<Args>(args)...);
+        ++tail->last;
+        return;
+    }
+
+    Node* node = create_node(nullptr, 0);
+
+    try
+    {
+        node_traits::construct(alloc, node->elements(),
+                               std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        deallocate_node(node);
+        throw;
+    }
+
+    ++node->last;
+
+    if (tail == nullptr)
+    {
+        head = node;
+    }
+    else
+    {
+        tail->next = node;
+    }
+
+    tail = node;
+}
+
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>&
+unrolled_linked_list<T, K, Allocator>::pop_front()
+{
+    if (empty())
+    {
+        return *this;
+    }
+
+    node_traits::destroy(alloc, head->elements() + head->first);
+    ++head->first;
+
+    // The head node is empty, free it and move on to the next node
+    if (head->first == head->last)
+    {
+        Node* temp = head->next;
+
+        if (tail == head)
+        {
+            tail = temp;
+        }
+
+        deallocate_node(head);
+
+        head = temp;
+    }
+
+    return *this;
+}
+
+template <typename T, std::size_t K, class Allocator>
+T& unrolled_linked_list<T, K, Allocator>::pop_front(reference out_param)
+{
+    if(!empty())
+    {
+        out_param = std::move(front());
+
+        pop_front();
+    }
+
+    return out_param;
+}
+
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>&
+unrolled_linked_list<T, K, Allocator>::clear()
+{
+    while (head != nullptr)
+    {
+        Node* temp = head->next;
+        destroy_node(head);
+        head = temp;
+    }
+
+    tail = nullptr;
+
+    return *this;
+}
+
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>&
+unrolled_linked_list<T, K, Allocator>::reverse()
+{
+    Node* prev = nullptr;
+    Node* current = head;
+
+    while (current != nullptr)
+    {
+        std::reverse(current->elements() + current->first,
+                     current->elements() + current->last);
+
+        Node* next = current->next;
+        current->next = prev;
+        prev = current;
+        current = next;
+    }
+
+    std::swap(head, tail);
+
+    return *this;
+}
+
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>&
+unrolled_linked_list<T, K, Allocator>::sort()
+{
+    return sort([](const T& lhs, const T& rhs){ return lhs < rhs; });
+}
+
+template <typename T, std::size_t K, class Allocator>
+template <class Compare>
+unrolled_linked_list<T, K, Allocator>&
+unrolled_linked_list<T, K, Allocator>::sort(Compare&& comp)
+{
+    if (head == nullptr || (head == tail && head->last - head->first < 2))
+    {
+        return *this;
+    }
+
+    typedef typename std::allocator_traits<Allocator>::template
+            rebind_alloc<pointer> pointer_allocator;
+
+    // Sort pointers to the elements first, so a throwing comp leaves every
+    // element where it was
+    std::vector<pointer, pointer_allocator> order((pointer_allocator(alloc)));
+    order.reserve(size());
+
+    for (reference element : *this)
+    {
+        order.push_back(std::addressof(element));
+    }
+
+    std::sort(order.begin(), order.end(), [&](pointer lhs, pointer rhs)
+    {
+        return comp(*lhs, *rhs);
+    });
+
+    std::vector<T, Allocator> buffer(get_allocator());
+    buffer.reserve(order.size());
+
+    for (pointer element : order)
+    {
+        buffer.push_back(std::move(*element));
+    }
+
+    // The node structure is unchanged, only the values are reassigned
+    typename std::vector<T, Allocator>::iterator sorted = buffer.begin();
+    for (reference element : *this)
+    {
+        element = std::move(*(sorted++));
+    }
+
+    return *this;
+}
+
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>
+unrolled_linked_list<T, K, Allocator>::split(const_iterator pos)
+{
+    unrolled_linked_list<T, K, Allocator> temp(get_allocator());
+
+    if(pos.node == nullptr)
+    {
+        return temp;
+    }
+
+    Node* node = pos.node;
+    index_type split_index = static_cast<index_type>(pos.index + 1);
+
+    // Elements after pos in its node are moved into a node of their own
+    if (split_index < node->last)
+    {
+        Node* front = create_node(node->next, 0);
+
+        for (index_type i = split_index; i < node->last; ++i)
+        {
+            node_traits::construct(alloc, front->elements() + front->last,
+                                   std::move(node->elements()[i]));
+            node_traits::destroy(alloc, node->elements() + i);
+            ++front->last;
+        }
+        node->last = split_index;
+
+        temp.head = front;
+        temp.tail = (node == tail) ? front : tail;
+    }
+    else
+    {
+        temp.head = node->next;
+        temp.tail = (temp.head == nullptr) ? nullptr : tail;
+    }
+
+    tail = node;
+    tail->next = nullptr;
+
+    return temp;
+}
+
+template <typename T, std::size_t K, class Allocator>
+unrolled_linked_list<T, K, Allocator>&
+unrolled_linked_list<T, K, Allocator>::merge(self_type& list)
+{
+    return merge(list, [](const T& lhs, const T& rhs){ return lhs < rhs; });
+}
+
+template <typename T, std::size_t K, class Allocator>
+template <class Compare>
+unrolled_linked_list<T, K, Allocator>&
+unrolled_linked_list<T, K, Allocator>::merge(self_type& list, Compare&& comp)
+{
+    if(&list == this)
+    {
+        return *this;
+    }
+
+    // Elements are moved into packed nodes, source nodes are freed as they
+    // empty so the merge never holds more than a few extra nodes
+    self_type merged(get_allocator());
+
+    try
+    {
+        while (!empty() && !list.empty())
+        {
+            // Equivalent elements keep this list's element first
+            if (comp(list.front(), front()))
+            {
+                merged.push_back(std::move(list.front()));
+                list.pop_front();
+            }
+            else
+            {
+                merged.push_back(std::move(front()));
+                pop_front();
+            }
+        }
+    }
+    catch (...)
+    {
+        // Give the elements merged so far back to the front of this list
+        if (merged.head != nullptr)
+        {
+            merged.tail->next = head;
+            if (tail == nullptr)
+            {
+                tail = merged.tail;
+            }
+            head = merged.head;
+            merged.head = merged.tail = nullptr;
+        }
+        throw;
+    }
+
+    // The remainder is already sorted, so its nodes are relinked as they are
+    self_type& rest = empty() ? list : *this;
+
+    if (!rest.empty())
+    {
+        if (merged.tail == nullptr)
+        {
+            merged.head = rest.head;
+        }
+        else
+        {
+            merged.tail->next = rest.head;
+        }
+        merged.tail = rest.tail;
+
+        rest.head = rest.tail = nullptr;
+    }
+
+    std::swap(head, merged.head);
+    std::swap(tail, merged.tail);
+
+    return *this;
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::iterator
+unrolled_linked_list<T, K, Allocator>::erase_after(iterator pos)
+{
+    Node* node = pos.node;
+
+    if (node == nullptr)
+    {
+        return pos;
+    }
+
+    // The element after pos shares its node, shift the rest of the node down
+    if (pos.index + 1 < node->last)
+    {
+        pointer elements = node->elements();
+
+        for (size_type i = pos.index + 1; i + 1 < node->last; ++i)
+        {
+            elements[i] = std::move(elements[i + 1]);
+        }
+
+        --node->last;
+        node_traits::destroy(alloc, elements + node->last);
+    }
+    // Otherwise the element after pos is the first element of the next node
+    else if (node->next != nullptr)
+    {
+        Node* next = node->next;
+
+        node_traits::destroy(alloc, next->elements() + next->first);
+        ++next->first;
+
+        if (next->first == next->last)
+        {
+            node->next = next->next;
+
+            if (tail == next)
+            {
+                tail = node;
+            }
+
+            deallocate_node(next);
+        }
+    }
+
+    return pos;
+}
+
+template <typename T, std::size_t K, class Allocator>
+int unrolled_linked_list<T, K, Allocator>::remove(const_reference target)
+{
+    // lambda catches target and compares it to each element in the list
+    return remove_if([&target](T& sample){ return target == sample; });
+}
+
+template <typename T, std::size_t K, class Allocator>
+template <class Predicate>
+int unrolled_linked_list<T, K, Allocator>::remove_if(Predicate&& pred)
+{
+    int removed = 0;
+
+    // Kept elements are moved down to the write position, which trails the
+    // read position through the same slots
+    Node* write_prev = nullptr;
+    Node* write_node = head;
+    size_type write = (head != nullptr) ? head->first : 0;
+
+    for (Node* node = head; node != nullptr; node = node->next)
+    {
+        for (size_type read = node->first; read < node->last; ++read)
+        {
+            reference element = node->elements()[read];
+
+            if (pred(element))
+            {
+                ++removed;
+                continue;
+            }
+
+            if (write_node != node || write != read)
+            {
+                write_node->elements()[write] = std::move(element);
+            }
+
+            if (++write == write_node->last)
+            {
+                write_prev = write_node;
+                write_node = write_node->next;
+                write = (write_node != nullptr) ? write_node->first : 0;
+            }
+        }
+    }
+
+    if (removed == 0)
+    {
+        return removed;
+    }
+
+    // Destroy the leftover elements of the last node written to
+    for (size_type i = write; i < write_node->last; ++i)
+    {
+        node_traits::destroy(alloc, write_node->elements() + i);
+    }
+    write_node->last = static_cast<index_type>(write);
+
+    // Free every node after the last element kept
+    Node* stale = write_node->next;
+    if (write_node->first == write_node->last)
+    {
+        stale = write_node;
+        write_node = write_prev;
+    }
+
+    while (stale != nullptr)
+    {
+        Node* temp = stale->next;
+        destroy_node(stale);
+        stale = temp;
+    }
+
+    tail = write_node;
+
+    if (tail == nullptr)
+    {
+        head = nullptr;
+    }
+    else
+    {
+        tail->next = nullptr;
+    }
+
+    return removed;
+}
+
+/****** CAPACITY ******/
+
+template <typename T, std::size_t K, class Allocator>
+bool unrolled_linked_list<T, K, Allocator>::empty() const
+{
+    return !(head);
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::size_type
+unrolled_linked_list<T, K, Allocator>::size() const
+{
+    size_type count = 0;
+
+    for (Node* node = head; node != nullptr; node = node->next)
+    {
+        count += node->last - node->first;
+    }
+
+    return count;
+}
+
+/****** ELEMENT ACCESS ******/
+
+template <typename T, std::size_t K, class Allocator>
+T& unrolled_linked_list<T, K, Allocator>::front()
+{
+    throw_if_null(head);
+
+    return head->elements()[head->first];
+}
+
+template <typename T, std::size_t K, class Allocator>
+const T& unrolled_linked_list<T, K, Allocator>::front() const
+{
+    throw_if_null(head);
+
+    return head->elements()[head->first];
+}
+
+template <typename T, std::size_t K, class Allocator>
+T& unrolled_linked_list<T, K, Allocator>::back()
+{
+    throw_if_null(tail);
+
+    return tail->elements()[tail->last - 1];
+}
+
+template <typename T, std::size_t K, class Allocator>
+const T& unrolled_linked_list<T, K, Allocator>::back() const
+{
+    throw_if_null(tail);
+
+    return tail->elements()[tail->last - 1];
+}
+
+/****** ITERATORS ******/
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::iterator
+unrolled_linked_list<T, K, Allocator>::begin()
+{
+    return iterator(head);
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::const_iterator
+unrolled_linked_list<T, K, Allocator>::begin() const
+{
+    return const_iterator(head);
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::iterator
+unrolled_linked_list<T, K, Allocator>::end()
+{
+    return iterator(nullptr);
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::const_iterator
+unrolled_linked_list<T, K, Allocator>::end() const
+{
+    return const_iterator(nullptr);
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::iterator
+unrolled_linked_list<T, K, Allocator>::middle()
+{
+    iterator it = begin();
+
+    // Matches the linear_linked_list, the first middle of an even length
+    for (size_type steps = (size() + 1) / 2; steps > 1; --steps)
+    {
+        ++it;
+    }
+
+    return it;
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::const_iterator
+unrolled_linked_list<T, K, Allocator>::middle() const
+{
+    const_iterator it = begin();
+
+    for (size_type steps = (size() + 1) / 2; steps > 1; --steps)
+    {
+        ++it;
+    }
+
+    return it;
+}
+
+/****** ALLOCATOR ******/
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::allocator_type
+unrolled_linked_list<T, K, Allocator>::get_allocator() const
+{
+    return allocator_type(alloc);
+}
+
+/****** COMPARISON OPERATORS ******/
+
+template <typename T, std::size_t K, class Allocator>
+bool unrolled_linked_list<T, K, Allocator>::operator==(const self_type& rhs) const
+{
+    // Compare sizes first
+    if (rhs.size() != size())
+    {
+        return false;
+    }
+
+    const_iterator left = begin();
+    const_iterator right = rhs.begin();
+
+    while(left != end() && right != rhs.end())
+    {
+        // If any element does not match then return false
+        if (*(left++) != *(right++))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T, std::size_t K, class Allocator>
+bool unrolled_linked_list<T, K, Allocator>::operator!=(const self_type& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::self_type&
+unrolled_linked_list<T, K, Allocator>::operator=(const self_type& origin)
+{
+    if (this == &origin)
+    {
+        return *this;
+    }
+
+    self_type copy(node_traits::propagate_on_container_copy_assignment::value
+                   ? origin.get_allocator() : get_allocator());
+
+    for (const_reference element : origin)
+    {
+        copy.push_back(element);
+    }
+
+    // Swap ownership of resources with the copy
+    swap_all(copy);
+
+    // As the copy goes out of scope it destructs with the old data
+    return *this;
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::self_type&
+unrolled_linked_list<T, K, Allocator>::operator=(self_type&& origin)
+{
+    if (this == &origin)
+    {
+        return *this;
+    }
+
+    clear();
+
+    if (node_traits::propagate_on_container_move_assignment::value)
+    {
+        swap_all(origin);
+    }
+    else if (alloc == origin.alloc)
+    {
+        swap(origin);
+    }
+    else
+    {
+        // Nodes cannot be freed by a different allocator, move each element
+        for (reference element : origin)
+        {
+            push_back(std::move(element));
+        }
+        origin.clear();
+    }
+
+    return *this;
+}
+
+template <typename T, std::size_t K, class Allocator>
+void unrolled_linked_list<T, K, Allocator>::swap(self_type& origin)
+{
+    using std::swap;
+
+    if (node_traits::propagate_on_container_swap::value)
+    {
+        swap(alloc, origin.alloc);
+    }
+
+    // Swaps pointers, reassigns ownership
+    swap(head, origin.head);
+    swap(tail, origin.tail);
+    return;
+}
+
+template <typename T, std::size_t K, class Allocator>
+void unrolled_linked_list<T, K, Allocator>::swap_all(self_type& origin)
+{
+    using std::swap;
+
+    swap(alloc, origin.alloc);
+    swap(head, origin.head);
+    swap(tail, origin.tail);
+    return;
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::Node*
+unrolled_linked_list<T, K, Allocator>::create_node(Node* next, index_type first)
+{
+    Node* node = node_traits::allocate(alloc, 1);
+
+    node_traits::construct(alloc, node, next, first);
+
+    return node;
+}
+
+template <typename T, std::size_t K, class Allocator>
+void unrolled_linked_list<T, K, Allocator>::destroy_node(Node* node)
+{
+    for (index_type i = node->first; i < node->last; ++i)
+    {
+        node_traits::destroy(alloc, node->elements() + i);
+    }
+
+    deallocate_node(node);
+}
+
+template <typename T, std::size_t K, class Allocator>
+void unrolled_linked_list<T, K, Allocator>::deallocate_node(Node* node)
+{
+    node_traits::destroy(alloc, node);
+    node_traits::deallocate(alloc, node, 1);
+}
+
+template <typename T, std::size_t K, class Allocator>
+void unrolled_linked_list<T, K, Allocator>::throw_if_null(Node* node) const
+{
+    if(node)
+    {
+        return;
+    }
+
+    throw std::logic_error("Element access fail, null pointer");
+}
+
+/*******************************************************************************
+ITERATOR CLASS
+*******************************************************************************/
+
+/* Operator Overloads */
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::const_iterator&
+unrolled_linked_list<T, K, Allocator>::const_iterator::operator++()
+{
+    // Step to the next element, moving on to the next node at the range's end
+    if (++index == node->last)
+    {
+        node = node->next;
+        index = (node != nullptr) ? node->first : 0;
+    }
+    return *this;
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::const_iterator
+unrolled_linked_list<T, K, Allocator>::const_iterator::operator++(int)
+{
+    // Create a copy to satisfy postfix incrementation requirements
+    self_type copy = self_type(*this);
+    ++(*this);
+    return copy;
+}
+
+template <typename T, std::size_t K, class Allocator>
+bool unrolled_linked_list<T, K, Allocator>::const_iterator::operator==(const self_type& rhs) const
+{
+    // Iterators are equal if they point to the same element
+    return node == rhs.node && index == rhs.index;
+}
+
+template <typename T, std::size_t K, class Allocator>
+bool unrolled_linked_list<T, K, Allocator>::const_iterator::operator!=(const self_type& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::const_reference
+unrolled_linked_list<T, K, Allocator>::const_iterator::operator*() const
+{
+    return node->elements()[index];
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::const_pointer
+unrolled_linked_list<T, K, Allocator>::const_iterator::operator->() const
+{
+    return node->elements() + index;
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::reference
+unrolled_linked_list<T, K, Allocator>::iterator::operator*()
+{
+    return this->node->elements()[this->index];
+}
+
+template <typename T, std::size_t K, class Allocator>
+typename unrolled_linked_list<T, K, Allocator>::pointer
+unrolled_linked_list<T, K, Allocator>::iterator::operator->()
+{
+    return this->node->elements() + this->index;
+}
+
+#endif //UNROLLED_LINKED_LIST_CPP
+
@@ -0,0 +1,392 @@
+/*
+
+ File: compact_linked_list_test.cpp
+
+ Brief: Unit tests for compact linked list data structure
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <catch.hpp>
+#include "compact_linked_list.hpp"
+
+typedef compact_linked_list<int> compact_list;
+
+// Counts the instances alive, and throws from its move constructor once the
+// allowed number of moves is used up
+struct brittle
+{
+    static int alive;
+    static int moves_left;
+
+    explicit brittle(int value = 0) : value(value) { ++alive; }
+    brittle(const brittle& origin) : value(origin.value) { ++alive; }
+    brittle(brittle&& origin) : value(origin.value)
+    {
+        if (moves_left-- == 0)
+        {
+            throw std::runtime_error("move failed");
+        }
+        ++alive;
+    }
+    brittle& operator=(const brittle& origin) { value = origin.value; return *this; }
+    ~brittle() { --alive; }
+
+    bool operator<(const brittle& rhs) const { return value < rhs.value; }
+
+    int value;
+};
+
+int brittle::alive = 0;
+int brittle::moves_left = -1;
+
+// Walks the list and checks it holds the sequence first, first + 1, ...
+static bool is_compact_sequence(const compact_list& list, int first, int last)
+{
+    int expected = first;
+    for (int num : list)
+    {
+        if (num != expected++)
+        {
+            return false;
+        }
+    }
+    return expected == last + 1;
+}
+
+TEST_CASE("Constructing compact_linked_list objects", "[compact], [constructors]")
+{
+    SECTION("Default construction")
+    {
+        compact_list list;
+
+        REQUIRE(list.empty());
+        REQUIRE(list.size() == 0);
+        REQUIRE(list.capacity() == 0);
+    }
+    SECTION("Initializer list construction")
+    {
+        compact_list list { 1, 2, 3, 4, 5 };
+
+        REQUIRE(list.size() == 5);
+        REQUIRE(is_compact_sequence(list, 1, 5));
+    }
+    SECTION("Ranged based construction with a standard container")
+    {
+        std::vector<int> nums = { 1, 2, 3, 4, 5 };
+
+        compact_list list(nums.begin(), nums.end());
+
+        REQUIRE(is_compact_sequence(list, 1, 5));
+    }
+    SECTION("Copy construction")
+    {
+        compact_list origin { 1, 2, 3, 4, 5 };
+        compact_list copy(origin);
+
+        REQUIRE(copy == origin);
+    }
+    SECTION("Move construction")
+    {
+        compact_list origin { 1, 2, 3, 4, 5 };
+        compact_list moved(std::move(origin));
+
+        REQUIRE(is_compact_sequence(moved, 1, 5));
+        REQUIRE(origin.empty());
+    }
+}
+
+TEST_CASE("Pushing and popping elements of a compact list", "[compact], [push], [pop_front]")
+{
+    compact_list list;
+
+    SECTION("Pushing to both ends grows the buffer")
+    {
+        for (int i = 50; i < 100; ++i)
+        {
+            list.push_back(i);
+        }
+        for (int i = 49; i >= 0; --i)
+        {
+            list.push_front(i);
+        }
+
+        REQUIRE(list.size() == 100);
+        REQUIRE(list.capacity() >= 100);
+        REQUIRE(is_compact_sequence(list, 0, 99));
+    }
+    SECTION("Popped slots are reused before the buffer grows")
+    {
+        list.reserve(4);
+        list.push_back(1).push_back(2).push_back(3).push_back(4);
+
+        int out = 0;
+        REQUIRE(list.pop_front(out) == 1);
+        REQUIRE(list.pop_front(out) == 2);
+
+        list.push_back(5).push_back(6);
+
+        REQUIRE(list.capacity() == 4);
+        REQUIRE(is_compact_sequence(list, 3, 6));
+    }
+    SECTION("Popping every element")
+    {
+        list.push_back(1).push_back(2);
+        list.pop_front().pop_front().pop_front();
+
+        REQUIRE(list.empty());
+        REQUIRE_THROWS(list.front());
+        REQUIRE_THROWS(list.back());
+        REQUIRE(list.push_back(3).back() == 3);
+    }
+    SECTION("Pushing an element of the list while the buffer grows")
+    {
+        list.reserve(1);
+        list.push_back(7);
+
+        list.push_back(list.front()).push_front(list.back());
+
+        REQUIRE(list.size() == 3);
+        REQUIRE(list.front() == 7);
+        REQUIRE(list.back() == 7);
+    }
+    SECTION("Elements with resources are moved when the buffer grows")
+    {
+        compact_linked_list<std::string> strings;
+        std::string word = "compact";
+
+        strings.push_back(std::move(word));
+        for (int i = 0; i < 20; ++i)
+        {
+            strings.push_back(std::string(32, 'a'));
+        }
+
+        REQUIRE(word.empty());
+        REQUIRE(strings.front() == "compact");
+        REQUIRE(strings.back() == std::string(32, 'a'));
+    }
+}
+
+TEST_CASE("Erasing and removing from a compact list", "[compact], [erase_after], [remove_if]")
+{
+    compact_list list { 1, 10, 2, 3, 10, 4, 10 };
+
+    SECTION("Erasing the element after an iterator")
+    {
+        list.erase_after(list.begin());
+
+        REQUIRE(list.size() == 6);
+        REQUIRE(*(++list.begin()) == 2);
+    }
+    SECTION("remove_if unlinks every match and updates the tail")
+    {
+        REQUIRE(list.remove(10) == 3);
+        REQUIRE(list.size() == 4);
+        REQUIRE(is_compact_sequence(list, 1, 4));
+        REQUIRE(list.push_back(5).back() == 5);
+    }
+    SECTION("Removed slots are reused")
+    {
+        size_t capacity = list.capacity();
+
+        list.remove(10);
+        list.push_back(5).push_back(6).push_back(7);
+
+        REQUIRE(list.capacity() == capacity);
+        REQUIRE(is_compact_sequence(list, 1, 7));
+    }
+    SECTION("remove_if on every element empties the list")
+    {
+        REQUIRE(list.remove_if([](int){ return true; }) == 7);
+        REQUIRE(list.empty());
+    }
+}
+
+TEST_CASE("Reversing, sorting and merging compact lists", "[compact], [sort], [merge], [reverse]")
+{
+    SECTION("Reversing a list")
+    {
+        compact_list list { 5, 4, 3, 2, 1 };
+
+        list.reverse();
+
+        REQUIRE(is_compact_sequence(list, 1, 5));
+        REQUIRE(list.back() == 5);
+    }
+    SECTION("Sorting into ascending order")
+    {
+        compact_list list { 3, 5, 2, 7, 1, 4, 6 };
+
+        list.sort();
+
+        REQUIRE(is_compact_sequence(list, 1, 7));
+        REQUIRE(list.back() == 7);
+    }
+    SECTION("Sorting with a custom compare function")
+    {
+        compact_list list { 3, 5, 2, 1, 4 };
+
+        list.sort([](int lhs, int rhs){ return lhs > rhs; });
+
+        REQUIRE(list.front() == 5);
+        REQUIRE(list.back() == 1);
+    }
+    SECTION("Merging two sorted lists")
+    {
+        compact_list first { 1, 3, 5, 7 };
+        compact_list second { 2, 4, 6, 8, 9 };
+
+        first.merge(second);
+
+        REQUIRE(is_compact_sequence(first, 1, 9));
+        REQUIRE(first.back() == 9);
+        REQUIRE(second.empty());
+    }
+    SECTION("Merging lists whose last elements are equal")
+    {
+        compact_list first { 1, 3 };
+        compact_list second { 2, 3 };
+
+        first.merge(second);
+
+        REQUIRE(first.size() == 4);
+        REQUIRE(first.back() == 3);
+        REQUIRE(first.push_back(4).back() == 4);
+    }
+    SECTION("Merging into an empty list")
+    {
+        compact_list first;
+        compact_list second { 1, 2, 3 };
+
+        first.merge(second);
+
+        REQUIRE(is_compact_sequence(first, 1, 3));
+        REQUIRE(first.back() == 3);
+    }
+    SECTION("A throwing move frees the slots of the moved elements")
+    {
+        {
+            compact_linked_list<brittle> first;
+            compact_linked_list<brittle> second;
+            for (int i = 0; i < 3; ++i)
+            {
+                first.push_back(brittle(2 * i + 1));
+                second.push_back(brittle(2 * i + 2));
+            }
+            first.reserve(6);
+            const std::size_t capacity = first.capacity();
+
+            brittle::moves_left = 2;
+            REQUIRE_THROWS_AS(first.merge(second), std::runtime_error);
+            brittle::moves_left = -1;
+
+            REQUIRE(brittle::alive == 6);
+            REQUIRE(first.size() == 3);
+            REQUIRE(second.size() == 3);
+
+            // The freed slots are reused without growing the buffer
+            first.push_back(brittle(7)).push_back(brittle(8)).push_back(brittle(9));
+            REQUIRE(first.capacity() == capacity);
+            REQUIRE(first.back().value == 9);
+        }
+        REQUIRE(brittle::alive == 0);
+    }
+    SECTION("A throwing compare function keeps every element linked")
+    {
+        compact_list first { 1, 3, 5, 7 };
+        compact_list second { 2, 4, 6, 8 };
+        int comparisons = 0;
+
+        REQUIRE_THROWS_AS(first.merge(second, [&comparisons](int lhs, int rhs)
+        {
+            if (++comparisons == 3)
+            {
+                throw std::runtime_error("compare failed");
+            }
+            return lhs < rhs;
+        }), std::runtime_error);
+
+        REQUIRE(first.size() == 8);
+        REQUIRE(first.back() == 8);
+
+        first.sort();
+        REQUIRE(is_compact_sequence(first, 1, 8));
+    }
+}
+
+TEST_CASE("Managing the capacity of a compact list", "[compact], [reserve], [shrink_to_fit]")
+{
+    compact_list list;
+
+    SECTION("Reserving capacity")
+    {
+        list.reserve(64);
+
+        REQUIRE(list.capacity() == 64);
+        REQUIRE(list.empty());
+    }
+    SECTION("Shrinking keeps the elements in order")
+    {
+        list.reserve(64);
+        list.push_back(2).push_front(1).push_back(3);
+
+        list.shrink_to_fit();
+
+        REQUIRE(list.capacity() == 3);
+        REQUIRE(is_compact_sequence(list, 1, 3));
+        REQUIRE(list.push_back(4).back() == 4);
+    }
+    SECTION("Clearing keeps the buffer")
+    {
+        list.reserve(16).push_back(1);
+
+        list.clear();
+
+        REQUIRE(list.empty());
+        REQUIRE(list.capacity() == 16);
+    }
+}
+
+TEST_CASE("Assigning and comparing compact lists", "[compact], [operators]")
+{
+    compact_list list { 1, 2, 3, 4 };
+
+    SECTION("Copy assignment")
+    {
+        compact_list copy;
+
+        REQUIRE((copy = list) == list);
+    }
+    SECTION("Move assignment")
+    {
+        compact_list moved;
+        moved = std::move(list);
+
+        REQUIRE(is_compact_sequence(moved, 1, 4));
+        REQUIRE(list.empty());
+    }
+    SECTION("Lists with different elements are not equal")
+    {
+        REQUIRE(list != compact_list { 1, 2, 3, 5 });
+        REQUIRE(list != compact_list { 1, 2, 3 });
+    }
+    SECTION("Mutable iterators modify the elements in place")
+    {
+        for (int& num : list)
+        {
+            num += 1;
+        }
+
+        REQUIRE(is_compact_sequence(list, 2, 5));
+    }
+}
@@ -0,0 +1,347 @@
+/*
+
+ File: concurrent_linked_list_test.cpp
+
+ Brief: Unit and stress tests for the concurrent linked list data structure
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include <catch.hpp>
+#include "concurrent_linked_list.hpp"
+
+namespace
+{
+    // Counts the instances alive, to check that every element is destroyed.
+    // Threads construct elements concurrently, so the count is atomic
+    struct tracked
+    {
+        static std::atomic<int> alive;
+
+        explicit tracked(int value = 0) : value(value) { ++alive; }
+        tracked(const tracked& origin) : value(origin.value) { ++alive; }
+        tracked& operator=(const tracked& origin) { value = origin.value; return *this; }
+        ~tracked() { --alive; }
+
+        bool operator==(const tracked& rhs) const { return value == rhs.value; }
+
+        int value;
+    };
+
+    std::atomic<int> tracked::alive(0);
+
+    // Throws from its constructor when given a negative value
+    struct picky
+    {
+        explicit picky(int value = 0) : value(value)
+        {
+            if (value < 0)
+            {
+                throw std::invalid_argument("negative");
+            }
+        }
+
+        bool operator==(const picky& rhs) const { return value == rhs.value; }
+
+        int value;
+    };
+
+    // Pops every element of the list into a vector, front first
+    template <typename T>
+    std::vector<T> drain(concurrent_linked_list<T>& list)
+    {
+        std::vector<T> elements;
+        T out;
+        while (list.try_pop_front(out))
+        {
+            elements.push_back(out);
+        }
+        return elements;
+    }
+}
+
+TEST_CASE("Using concurrent_linked_list from one thread", "[concurrent_linked_list]")
+{
+    concurrent_linked_list<int> list;
+
+    SECTION("A new list is empty")
+    {
+        int out = -1;
+
+        REQUIRE(list.empty());
+        REQUIRE(list.size() == 0);
+        REQUIRE_FALSE(list.try_pop_front(out));
+        REQUIRE_FALSE(list.find(0));
+        REQUIRE_FALSE(list.insert_after(0, 1));
+        REQUIRE_FALSE(list.erase_after(0));
+        REQUIRE(list.remove(0) == 0);
+        REQUIRE(out == -1);
+    }
+    SECTION("push_front adds elements to the front")
+    {
+        list.push_front(3).push_front(2).emplace_front(1);
+
+        REQUIRE(list.size() == 3);
+        REQUIRE(drain(list) == std::vector<int>({ 1, 2, 3 }));
+        REQUIRE(list.empty());
+    }
+    SECTION("insert_after links after the first element equal to the target")
+    {
+        list.push_front(3).push_front(1).push_front(1);
+
+        REQUIRE(list.insert_after(1, 2));
+        REQUIRE(list.emplace_after(3, 4));
+        REQUIRE_FALSE(list.insert_after(5, 6));
+
+        REQUIRE(list.size() == 5);
+        REQUIRE(drain(list) == std::vector<int>({ 1, 2, 1, 3, 4 }));
+    }
+    SECTION("erase_after removes the element after the target")
+    {
+        list.push_front(3).push_front(2).push_front(1);
+
+        REQUIRE(list.erase_after(1));
+        REQUIRE_FALSE(list.erase_after(3));
+        REQUIRE_FALSE(list.erase_after(5));
+
+        REQUIRE(list.size() == 2);
+        REQUIRE(drain(list) == std::vector<int>({ 1, 3 }));
+    }
+    SECTION("remove and remove_if remove every matching element")
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            list.push_front(i);
+        }
+        list.push_front(0);
+
+        REQUIRE(list.remove(0) == 2);
+        REQUIRE(list.remove_if([](int num){ return num % 2 == 1; }) == 5);
+        REQUIRE(list.remove_if([](int num){ return num > 100; }) == 0);
+
+        REQUIRE(list.size() == 4);
+        REQUIRE(drain(list) == std::vector<int>({ 8, 6, 4, 2 }));
+    }
+    SECTION("find and find_if search the list")
+    {
+        list.push_front(30).push_front(20).push_front(10);
+
+        int out = 0;
+        REQUIRE(list.find(20));
+        REQUIRE_FALSE(list.find(40));
+        REQUIRE(list.find_if([](int num){ return num > 15; }, out));
+        REQUIRE(out == 20);
+        REQUIRE_FALSE(list.find_if([](int num){ return num > 30; }, out));
+        REQUIRE(out == 20);
+    }
+}
+
+TEST_CASE("Holding non-trivial elements in a concurrent_linked_list", "[concurrent_linked_list]")
+{
+    SECTION("Move-only elements are moved in and out")
+    {
+        concurrent_linked_list<std::unique_ptr<int>> list;
+        list.push_front(std::unique_ptr<int>(new int(7)));
+
+        std::unique_ptr<int> out;
+        REQUIRE(list.try_pop_front(out));
+        REQUIRE(*out == 7);
+    }
+    SECTION("Removed, erased and remaining elements are destroyed")
+    {
+        {
+            concurrent_linked_list<tracked> list;
+            for (int i = 0; i < 6; ++i)
+            {
+                list.emplace_front(i);
+            }
+            REQUIRE(tracked::alive == 6);
+
+            list.erase_after(tracked(5));
+            list.remove(tracked(0));
+            REQUIRE(tracked::alive == 4);
+
+            REQUIRE_FALSE(list.insert_after(tracked(9), tracked(10)));
+            REQUIRE(tracked::alive == 4);
+        }
+        REQUIRE(tracked::alive == 0);
+    }
+    SECTION("A throwing predicate leaves the list usable")
+    {
+        concurrent_linked_list<int> list;
+        list.push_front(3).push_front(2).push_front(1);
+
+        REQUIRE_THROWS_AS(list.remove_if([](int num)
+        {
+            if (num == 2)
+            {
+                throw std::runtime_error("predicate");
+            }
+            return num == 1;
+        }), std::runtime_error);
+
+        REQUIRE(list.size() == 2);
+        REQUIRE(list.insert_after(3, 4));
+        REQUIRE(drain(list) == std::vector<int>({ 2, 3, 4 }));
+    }
+    SECTION("A throwing constructor leaves the list unchanged")
+    {
+        concurrent_linked_list<picky> list;
+        list.emplace_front(1);
+
+        REQUIRE_THROWS_AS(list.emplace_front(-1), std::invalid_argument);
+        REQUIRE_THROWS_AS(list.emplace_after(picky(1), -1), std::invalid_argument);
+
+        REQUIRE(list.size() == 1);
+        REQUIRE(list.find(picky(1)));
+    }
+    SECTION("Strings keep their contents")
+    {
+        concurrent_linked_list<std::string> list;
+        list.push_front("a string too long for small string storage");
+
+        std::string out;
+        REQUIRE(list.find_if([](const std::string& str){ return !str.empty(); }, out));
+        REQUIRE(out == "a string too long for small string storage");
+    }
+}
+
+TEST_CASE("Stress testing concurrent_linked_list with inserting and erasing threads", "[concurrent_linked_list], [stress]")
+{
+    const int threads_count = 4;
+    const int per_thread = 2000;
+
+    // Each thread owns a marker and grows its own run of elements behind it,
+    // while the other threads search and remove_if across the whole list
+    concurrent_linked_list<tracked> list;
+    for (int t = 0; t < threads_count; ++t)
+    {
+        list.emplace_front(-1 - t);
+    }
+
+    std::atomic<bool> start(false);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&list, &start, t, threads_count, per_thread]()
+        {
+            while (!start.load())
+            {
+                std::this_thread::yield();
+            }
+
+            const tracked marker(-1 - t);
+            for (int i = 0; i < per_thread; ++i)
+            {
+                const int value = t * per_thread + i;
+
+                // Only this thread changes its run, so the pair is still
+                // behind the marker and one of them is erased
+                list.insert_after(marker, tracked(value));
+                list.insert_after(marker, tracked(value));
+                list.erase_after(marker);
+                list.find(tracked((t + 1) % threads_count * per_thread + i));
+
+                if (i % 100 == 0)
+                {
+                    list.remove_if([value](const tracked& element)
+                    {
+                        return element.value == value;
+                    });
+                }
+            }
+        });
+    }
+
+    start.store(true);
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every marker is still in the list, and the count matches the links
+    for (int t = 0; t < threads_count; ++t)
+    {
+        REQUIRE(list.find(tracked(-1 - t)));
+    }
+    const int remaining = tracked::alive;
+    REQUIRE(remaining == threads_count * (per_thread - per_thread / 100 + 1));
+    REQUIRE(static_cast<size_t>(remaining) == list.size());
+
+    int popped = 0;
+    tracked out;
+    while (list.try_pop_front(out))
+    {
+        ++popped;
+    }
+    REQUIRE(popped == remaining);
+    REQUIRE(tracked::alive == 1);
+}
+
+TEST_CASE("Stress testing concurrent_linked_list while the front is popped", "[concurrent_linked_list], [stress]")
+{
+    const int pushers = 2;
+    const int per_pusher = 10000;
+
+    concurrent_linked_list<int> list;
+    std::atomic<int> pushing(pushers);
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < pushers; ++p)
+    {
+        threads.emplace_back([&list, &pushing, per_pusher]()
+        {
+            for (int i = 1; i <= per_pusher; ++i)
+            {
+                list.push_front(i);
+            }
+            --pushing;
+        });
+    }
+
+    // Searches for an element that is never there, walking the whole list
+    // behind the pops
+    threads.emplace_back([&list, &pushing]()
+    {
+        while (pushing.load() > 0)
+        {
+            list.find(0);
+        }
+    });
+
+    long long sum = 0;
+    int out = 0;
+    while (pushing.load() > 0)
+    {
+        if (list.try_pop_front(out))
+        {
+            sum += out;
+        }
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    while (list.try_pop_front(out))
+    {
+        sum += out;
+    }
+
+    const long long expected = static_cast<long long>(pushers)
+                             * per_pusher * (per_pusher + 1) / 2;
+    REQUIRE(sum == expected);
+    REQUIRE(list.empty());
+}
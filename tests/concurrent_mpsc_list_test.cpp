@@ -0,0 +1,253 @@
+/*
+
+ File: concurrent_mpsc_list_test.cpp
+
+ Brief: Unit and stress tests for the concurrent mpsc list data structure
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include <catch.hpp>
+#include "concurrent_mpsc_list.hpp"
+
+namespace
+{
+    // Counts the instances alive, to check that every element is destroyed.
+    // Producers construct elements concurrently, so the count is atomic
+    struct tracked
+    {
+        static std::atomic<int> alive;
+
+        explicit tracked(int value = 0) : value(value) { ++alive; }
+        tracked(const tracked& origin) : value(origin.value) { ++alive; }
+        tracked& operator=(const tracked& origin) { value = origin.value; return *this; }
+        ~tracked() { --alive; }
+
+        int value;
+    };
+
+    std::atomic<int> tracked::alive(0);
+
+    // Throws from its constructor when given a negative value
+    struct picky
+    {
+        explicit picky(int value = 0) : value(value)
+        {
+            if (value < 0)
+            {
+                throw std::invalid_argument("negative");
+            }
+        }
+
+        int value;
+    };
+
+    // Identifies an element by the producer that pushed it and its position
+    struct ticket
+    {
+        int producer;
+        int sequence;
+    };
+}
+
+TEST_CASE("Using concurrent_mpsc_list from one thread", "[concurrent_mpsc]")
+{
+    concurrent_mpsc_list<int> list;
+
+    SECTION("A new list is empty")
+    {
+        int out = -1;
+
+        REQUIRE(list.empty());
+        REQUIRE_FALSE(list.try_pop_front(out));
+        REQUIRE(out == -1);
+    }
+    SECTION("Elements are popped in the order they were pushed")
+    {
+        list.push_back(1).push_back(2).emplace_back(3);
+        REQUIRE_FALSE(list.empty());
+
+        int out = 0;
+        for (int i = 1; i <= 3; ++i)
+        {
+            REQUIRE(list.try_pop_front(out));
+            REQUIRE(out == i);
+        }
+
+        REQUIRE(list.empty());
+        REQUIRE_FALSE(list.try_pop_front(out));
+    }
+    SECTION("pop_front returns the element it moved out")
+    {
+        list.push_back(42);
+
+        int out = 0;
+        REQUIRE(list.pop_front(out) == 42);
+        REQUIRE(list.empty());
+    }
+    SECTION("The list can be emptied and refilled")
+    {
+        int out = 0;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_back(i);
+            REQUIRE(list.try_pop_front(out));
+            REQUIRE(out == i);
+        }
+        REQUIRE(list.empty());
+    }
+}
+
+TEST_CASE("Holding non-trivial elements in a concurrent_mpsc_list", "[concurrent_mpsc]")
+{
+    SECTION("Move-only elements are moved in and out")
+    {
+        concurrent_mpsc_list<std::unique_ptr<int>> list;
+        list.push_back(std::unique_ptr<int>(new int(7)));
+
+        std::unique_ptr<int> out;
+        REQUIRE(list.try_pop_front(out));
+        REQUIRE(*out == 7);
+    }
+    SECTION("Popped and remaining elements are destroyed")
+    {
+        {
+            concurrent_mpsc_list<tracked> list;
+            list.emplace_back(1).emplace_back(2).emplace_back(3);
+            REQUIRE(tracked::alive == 3);
+
+            tracked out;
+            list.try_pop_front(out);
+            REQUIRE(tracked::alive == 3);
+        }
+        REQUIRE(tracked::alive == 0);
+    }
+    SECTION("A throwing constructor leaves the list unchanged")
+    {
+        concurrent_mpsc_list<picky> list;
+        list.emplace_back(1);
+
+        REQUIRE_THROWS_AS(list.emplace_back(-1), std::invalid_argument);
+
+        picky out;
+        REQUIRE(list.try_pop_front(out));
+        REQUIRE(out.value == 1);
+        REQUIRE_FALSE(list.try_pop_front(out));
+    }
+    SECTION("Strings keep their contents")
+    {
+        concurrent_mpsc_list<std::string> list;
+        list.push_back("a string too long for small string storage");
+
+        std::string out;
+        REQUIRE(list.try_pop_front(out));
+        REQUIRE(out == "a string too long for small string storage");
+    }
+}
+
+TEST_CASE("Stress testing concurrent_mpsc_list with many producers", "[concurrent_mpsc], [stress]")
+{
+    const int producers = 4;
+    const int per_producer = 50000;
+
+    concurrent_mpsc_list<ticket> list;
+    std::atomic<bool> start(false);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&list, &start, p, per_producer]()
+        {
+            while (!start.load())
+            {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < per_producer; ++i)
+            {
+                list.push_back(ticket{ p, i });
+            }
+        });
+    }
+
+    start.store(true);
+
+    // Each producer's elements must arrive in the order it pushed them
+    std::vector<int> next(producers, 0);
+    bool ordered = true;
+    ticket out = { 0, 0 };
+    for (int received = 0; received < producers * per_producer; ++received)
+    {
+        list.pop_front(out);
+        ordered = ordered && out.sequence == next[out.producer]++;
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    REQUIRE(ordered);
+    REQUIRE(list.empty());
+    for (int p = 0; p < producers; ++p)
+    {
+        REQUIRE(next[p] == per_producer);
+    }
+}
+
+TEST_CASE("Stress testing concurrent_mpsc_list while producers come and go", "[concurrent_mpsc], [stress]")
+{
+    const int rounds = 50;
+    const int producers = 3;
+    const int per_producer = 1000;
+
+    concurrent_mpsc_list<tracked> list;
+    long long sum = 0;
+
+    for (int round = 0; round < rounds; ++round)
+    {
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p)
+        {
+            threads.emplace_back([&list, per_producer]()
+            {
+                for (int i = 1; i <= per_producer; ++i)
+                {
+                    list.emplace_back(i);
+                }
+            });
+        }
+
+        // Pops while the producers are running, the rest after they finish
+        tracked out;
+        for (int i = 0; i < producers * per_producer / 2; ++i)
+        {
+            sum += list.pop_front(out).value;
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        while (list.try_pop_front(out))
+        {
+            sum += out.value;
+        }
+    }
+
+    const long long per_round = static_cast<long long>(producers)
+                              * per_producer * (per_producer + 1) / 2;
+    REQUIRE(sum == per_round * rounds);
+    REQUIRE(tracked::alive == 0);
+}
@@ -0,0 +1,285 @@
+/*
+
+ File: concurrent_ordered_set_test.cpp
+
+ Brief: Unit and stress tests for the concurrent ordered set data structure
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include <functional>
+#include <catch.hpp>
+#include "concurrent_ordered_set.hpp"
+
+namespace
+{
+    // Counts the instances alive, to check that every element is destroyed.
+    // Threads construct elements concurrently, so the count is atomic
+    struct tracked
+    {
+        static std::atomic<int> alive;
+
+        explicit tracked(int value = 0) : value(value) { ++alive; }
+        tracked(const tracked& origin) : value(origin.value) { ++alive; }
+        tracked& operator=(const tracked& origin) { value = origin.value; return *this; }
+        ~tracked() { --alive; }
+
+        bool operator<(const tracked& rhs) const { return value < rhs.value; }
+
+        int value;
+    };
+
+    std::atomic<int> tracked::alive(0);
+
+    // Throws from its constructor when given a negative value
+    struct picky
+    {
+        explicit picky(int value = 0) : value(value)
+        {
+            if (value < 0)
+            {
+                throw std::invalid_argument("negative");
+            }
+        }
+
+        bool operator<(const picky& rhs) const { return value < rhs.value; }
+
+        int value;
+    };
+}
+
+TEST_CASE("Using concurrent_ordered_set from one thread", "[concurrent_ordered_set]")
+{
+    concurrent_ordered_set<int> set;
+
+    SECTION("A new set is empty")
+    {
+        REQUIRE(set.empty());
+        REQUIRE(set.size() == 0);
+        REQUIRE_FALSE(set.contains(0));
+        REQUIRE_FALSE(set.erase(0));
+    }
+    SECTION("Inserted elements are found")
+    {
+        REQUIRE(set.insert(5));
+        REQUIRE(set.insert(1));
+        REQUIRE(set.emplace(3));
+
+        REQUIRE(set.size() == 3);
+        REQUIRE(set.contains(1));
+        REQUIRE(set.contains(3));
+        REQUIRE(set.contains(5));
+        REQUIRE_FALSE(set.contains(0));
+        REQUIRE_FALSE(set.contains(4));
+        REQUIRE_FALSE(set.contains(6));
+    }
+    SECTION("Equivalent elements are only inserted once")
+    {
+        REQUIRE(set.insert(2));
+        REQUIRE_FALSE(set.insert(2));
+        REQUIRE_FALSE(set.emplace(2));
+
+        REQUIRE(set.size() == 1);
+    }
+    SECTION("Erased elements are no longer found")
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            set.insert(i);
+        }
+
+        REQUIRE(set.erase(0));
+        REQUIRE(set.erase(5));
+        REQUIRE(set.erase(9));
+        REQUIRE_FALSE(set.erase(5));
+        REQUIRE_FALSE(set.erase(10));
+
+        REQUIRE(set.size() == 7);
+        for (int i = 0; i < 10; ++i)
+        {
+            REQUIRE(set.contains(i) == (i != 0 && i != 5 && i != 9));
+        }
+
+        REQUIRE(set.insert(5));
+        REQUIRE(set.contains(5));
+    }
+    SECTION("The set can be emptied and refilled")
+    {
+        for (int round = 0; round < 3; ++round)
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                REQUIRE(set.insert(i));
+            }
+            for (int i = 199; i >= 0; --i)
+            {
+                REQUIRE(set.erase(i));
+            }
+            REQUIRE(set.empty());
+        }
+    }
+}
+
+TEST_CASE("Ordering a concurrent_ordered_set with a comparison", "[concurrent_ordered_set]")
+{
+    SECTION("The comparison decides equivalence")
+    {
+        concurrent_ordered_set<int, std::greater<int>> set;
+        set.insert(1);
+        set.insert(3);
+        set.insert(2);
+
+        REQUIRE(set.contains(2));
+        REQUIRE(set.value_comp()(3, 2));
+    }
+    SECTION("Strings keep their contents")
+    {
+        concurrent_ordered_set<std::string> set;
+        REQUIRE(set.insert("a string too long for small string storage"));
+        REQUIRE(set.insert("another string too long for small string storage"));
+
+        REQUIRE(set.contains("a string too long for small string storage"));
+        REQUIRE(set.erase("a string too long for small string storage"));
+        REQUIRE(set.contains("another string too long for small string storage"));
+    }
+    SECTION("Rejected, erased and remaining elements are destroyed")
+    {
+        {
+            concurrent_ordered_set<tracked> set;
+            for (int i = 0; i < 100; ++i)
+            {
+                set.emplace(i);
+            }
+            REQUIRE_FALSE(set.emplace(7));
+            REQUIRE(tracked::alive == 100);
+
+            for (int i = 0; i < 100; i += 2)
+            {
+                set.erase(tracked(i));
+            }
+        }
+        REQUIRE(tracked::alive == 0);
+    }
+    SECTION("A throwing constructor leaves the set unchanged")
+    {
+        concurrent_ordered_set<picky> set;
+        set.emplace(1);
+
+        REQUIRE_THROWS_AS(set.emplace(-1), std::invalid_argument);
+
+        REQUIRE(set.size() == 1);
+        REQUIRE(set.contains(picky(1)));
+    }
+}
+
+TEST_CASE("Stress testing concurrent_ordered_set with disjoint writers", "[concurrent_ordered_set], [stress]")
+{
+    const int threads_count = 4;
+    const int per_thread = 2000;
+
+    concurrent_ordered_set<tracked> set;
+    std::atomic<bool> start(false);
+
+    // Threads interleave their elements, so neighbouring nodes belong to
+    // different threads. Each keeps the multiples of 3 and erases the rest
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&set, &start, t, threads_count, per_thread]()
+        {
+            while (!start.load())
+            {
+                std::this_thread::yield();
+            }
+
+            for (int i = 0; i < per_thread; ++i)
+            {
+                set.emplace(i * threads_count + t);
+            }
+            for (int i = 0; i < per_thread; ++i)
+            {
+                if (i % 3 != 0)
+                {
+                    set.erase(tracked(i * threads_count + t));
+                }
+                set.contains(tracked(i * threads_count + (t + 1) % threads_count));
+            }
+        });
+    }
+
+    start.store(true);
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    const int kept = threads_count * ((per_thread + 2) / 3);
+    REQUIRE(set.size() == static_cast<size_t>(kept));
+    for (int value = 0; value < threads_count * per_thread; ++value)
+    {
+        REQUIRE(set.contains(tracked(value)) == (value / threads_count % 3 == 0));
+    }
+}
+
+TEST_CASE("Stress testing concurrent_ordered_set with contended elements", "[concurrent_ordered_set], [stress]")
+{
+    const int threads_count = 4;
+    const int rounds = 5000;
+    const int range = 64;
+
+    concurrent_ordered_set<int> set;
+    std::atomic<int> inserted(0);
+    std::atomic<int> erased(0);
+
+    // Every thread inserts and erases the same few elements, an element is
+    // only reported inserted or erased by the thread that changed it
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&set, &inserted, &erased, t, rounds, range]()
+        {
+            int inserts = 0;
+            int erases = 0;
+            for (int i = 0; i < rounds; ++i)
+            {
+                const int value = (i * 7 + t * 13) % range;
+                if ((i + t) % 2 == 0)
+                {
+                    inserts += set.insert(value);
+                }
+                else
+                {
+                    erases += set.erase(value);
+                }
+            }
+            inserted += inserts;
+            erased += erases;
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    int remaining = 0;
+    for (int value = 0; value < range; ++value)
+    {
+        remaining += set.contains(value);
+    }
+
+    REQUIRE(inserted - erased == remaining);
+    REQUIRE(set.size() == static_cast<size_t>(remaining));
+}
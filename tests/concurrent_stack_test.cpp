@@ -0,0 +1,301 @@
+/*
+
+ File: concurrent_stack_test.cpp
+
+ Brief: Unit and stress tests for the concurrent stack data structure
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include <catch.hpp>
+#include "concurrent_stack.hpp"
+
+namespace
+{
+    // Counts the instances alive, to check that every element is destroyed.
+    // Threads construct elements concurrently, so the count is atomic
+    struct tracked
+    {
+        static std::atomic<int> alive;
+
+        explicit tracked(int value = 0) : value(value) { ++alive; }
+        tracked(const tracked& origin) : value(origin.value) { ++alive; }
+        tracked& operator=(const tracked& origin) { value = origin.value; return *this; }
+        ~tracked() { --alive; }
+
+        int value;
+    };
+
+    std::atomic<int> tracked::alive(0);
+
+    // Throws from its constructor when given a negative value
+    struct picky
+    {
+        explicit picky(int value = 0) : value(value)
+        {
+            if (value < 0)
+            {
+                throw std::invalid_argument("negative");
+            }
+        }
+
+        int value;
+    };
+}
+
+TEST_CASE("Using concurrent_stack from one thread", "[concurrent_stack]")
+{
+    concurrent_stack<int> stack;
+
+    SECTION("A new stack is empty")
+    {
+        int out = -1;
+
+        REQUIRE(stack.empty());
+        REQUIRE_FALSE(stack.try_pop_front(out));
+        REQUIRE(out == -1);
+        REQUIRE(stack.pop_all().empty());
+    }
+    SECTION("Elements are popped in the reverse order they were pushed")
+    {
+        stack.push_front(1).push_front(2).emplace_front(3);
+        REQUIRE_FALSE(stack.empty());
+
+        int out = 0;
+        for (int i = 3; i >= 1; --i)
+        {
+            REQUIRE(stack.try_pop_front(out));
+            REQUIRE(out == i);
+        }
+
+        REQUIRE(stack.empty());
+        REQUIRE_FALSE(stack.try_pop_front(out));
+    }
+    SECTION("pop_front returns the element it moved out")
+    {
+        stack.push_front(42);
+
+        int out = 0;
+        REQUIRE(stack.pop_front(out) == 42);
+        REQUIRE(stack.empty());
+    }
+    SECTION("pop_all returns every element as a list, top first")
+    {
+        for (int i = 0; i < 5; ++i)
+        {
+            stack.push_front(i);
+        }
+
+        linear_linked_list<int> list = stack.pop_all();
+
+        REQUIRE(stack.empty());
+        REQUIRE(list == linear_linked_list<int>({ 4, 3, 2, 1, 0 }));
+        REQUIRE(list.size() == 5);
+        REQUIRE(list.back() == 0);
+    }
+    SECTION("The list taken by pop_all can be modified")
+    {
+        stack.push_front(2).push_front(1);
+
+        linear_linked_list<int> list = stack.pop_all();
+        list.push_back(3).push_front(0);
+
+        REQUIRE(list == linear_linked_list<int>({ 0, 1, 2, 3 }));
+    }
+    SECTION("The stack can be emptied and refilled")
+    {
+        int out = 0;
+        for (int i = 0; i < 500; ++i)
+        {
+            stack.push_front(i).push_front(i + 1);
+            REQUIRE(stack.try_pop_front(out));
+            REQUIRE(out == i + 1);
+            REQUIRE(stack.try_pop_front(out));
+            REQUIRE(out == i);
+        }
+        REQUIRE(stack.empty());
+    }
+}
+
+TEST_CASE("Holding non-trivial elements in a concurrent_stack", "[concurrent_stack]")
+{
+    SECTION("Move-only elements are moved in and out")
+    {
+        concurrent_stack<std::unique_ptr<int>> stack;
+        stack.push_front(std::unique_ptr<int>(new int(7)));
+
+        std::unique_ptr<int> out;
+        REQUIRE(stack.try_pop_front(out));
+        REQUIRE(*out == 7);
+    }
+    SECTION("Popped, taken and remaining elements are destroyed")
+    {
+        {
+            concurrent_stack<tracked> stack;
+            stack.emplace_front(1).emplace_front(2).emplace_front(3);
+            REQUIRE(tracked::alive == 3);
+
+            tracked out;
+            stack.try_pop_front(out);
+            REQUIRE(tracked::alive == 3);
+
+            {
+                linear_linked_list<tracked> list = stack.pop_all();
+                REQUIRE(list.size() == 2);
+            }
+            REQUIRE(tracked::alive == 1);
+
+            stack.emplace_front(4).emplace_front(5);
+            REQUIRE(tracked::alive == 3);
+        }
+        REQUIRE(tracked::alive == 0);
+    }
+    SECTION("A throwing constructor leaves the stack unchanged")
+    {
+        concurrent_stack<picky> stack;
+        stack.emplace_front(1);
+
+        REQUIRE_THROWS_AS(stack.emplace_front(-1), std::invalid_argument);
+
+        picky out;
+        REQUIRE(stack.try_pop_front(out));
+        REQUIRE(out.value == 1);
+        REQUIRE_FALSE(stack.try_pop_front(out));
+    }
+    SECTION("Strings keep their contents")
+    {
+        concurrent_stack<std::string> stack;
+        stack.push_front("a string too long for small string storage");
+
+        std::string out;
+        REQUIRE(stack.try_pop_front(out));
+        REQUIRE(out == "a string too long for small string storage");
+    }
+}
+
+TEST_CASE("Stress testing concurrent_stack with pushing and popping threads", "[concurrent_stack], [stress]")
+{
+    const int threads_count = 4;
+    const int per_thread = 20000;
+
+    concurrent_stack<tracked> stack;
+    std::atomic<bool> start(false);
+    std::atomic<long long> popped_sum(0);
+
+    // Each thread pushes its own elements and pops as many, popping each
+    // other's nodes as they are pushed, freed and reallocated
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&stack, &start, &popped_sum, per_thread]()
+        {
+            while (!start.load())
+            {
+                std::this_thread::yield();
+            }
+
+            long long sum = 0;
+            tracked out;
+            for (int i = 1; i <= per_thread; ++i)
+            {
+                stack.emplace_front(i);
+                if (i % 2 == 0)
+                {
+                    sum += stack.pop_front(out).value;
+                    sum += stack.pop_front(out).value;
+                }
+            }
+            popped_sum += sum;
+        });
+    }
+
+    start.store(true);
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    const long long expected = static_cast<long long>(threads_count)
+                             * per_thread * (per_thread + 1) / 2;
+    REQUIRE(popped_sum == expected);
+    REQUIRE(stack.empty());
+    REQUIRE(tracked::alive == 0);
+}
+
+TEST_CASE("Stress testing concurrent_stack while pop_all takes the elements", "[concurrent_stack], [stress]")
+{
+    const int pushers = 2;
+    const int poppers = 2;
+    const int per_pusher = 20000;
+
+    concurrent_stack<tracked> stack;
+    std::atomic<int> pushing(pushers);
+    std::atomic<long long> popped_sum(0);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < pushers; ++p)
+    {
+        threads.emplace_back([&stack, &pushing, per_pusher]()
+        {
+            for (int i = 1; i <= per_pusher; ++i)
+            {
+                stack.emplace_front(i);
+            }
+            --pushing;
+        });
+    }
+    for (int p = 0; p < poppers; ++p)
+    {
+        threads.emplace_back([&stack, &pushing, &popped_sum]()
+        {
+            long long sum = 0;
+            tracked out;
+            while (pushing.load() > 0)
+            {
+                if (stack.try_pop_front(out))
+                {
+                    sum += out.value;
+                }
+            }
+            popped_sum += sum;
+        });
+    }
+
+    // Takes the stack in batches while the other threads push and pop
+    long long taken_sum = 0;
+    while (pushing.load() > 0)
+    {
+        linear_linked_list<tracked> list = stack.pop_all();
+        for (const tracked& element : list)
+        {
+            taken_sum += element.value;
+        }
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    for (const tracked& element : stack.pop_all())
+    {
+        taken_sum += element.value;
+    }
+
+    const long long expected = static_cast<long long>(pushers)
+                             * per_pusher * (per_pusher + 1) / 2;
+    REQUIRE(taken_sum + popped_sum == expected);
+    REQUIRE(stack.empty());
+    REQUIRE(tracked::alive == 0);
+}
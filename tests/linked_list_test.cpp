@@ -15,7 +15,13 @@
 */
 
 
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <thread>
 #include <vector>
+#include <sstream>
+#include <iterator>
 #include <iostream>
 #include <catch.hpp>
 #include "linear_linked_list.hpp"
@@ -63,6 +69,99 @@ class Data
 };
 int Data::move_count = 0;
 
+// Records the allocator traffic of every list sharing the log
+struct allocation_log
+{
+    int allocations = 0;
+    int deallocations = 0;
+};
+
+// Stateful test allocator, instances compare equal if they share an id
+template <typename T, bool Propagate = true>
+struct tracking_allocator
+{
+    typedef T value_type;
+    typedef std::integral_constant<bool, Propagate> propagate_on_container_copy_assignment;
+    typedef std::integral_constant<bool, Propagate> propagate_on_container_move_assignment;
+    typedef std::integral_constant<bool, Propagate> propagate_on_container_swap;
+
+    template <typename U>
+    struct rebind { typedef tracking_allocator<U, Propagate> other; };
+
+    tracking_allocator(allocation_log* log, int id = 0)
+        : log(log), id(id) {}
+
+    template <typename U>
+    tracking_allocator(const tracking_allocator<U, Propagate>& origin)
+        : log(origin.log), id(origin.id) {}
+
+    T* allocate(std::size_t n)
+    {
+        log->allocations += static_cast<int>(n);
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t n)
+    {
+        log->deallocations += static_cast<int>(n);
+        ::operator delete(ptr);
+    }
+
+    template <typename U>
+    bool operator==(const tracking_allocator<U, Propagate>& rhs) const
+    {
+        return id == rhs.id;
+    }
+
+    template <typename U>
+    bool operator!=(const tracking_allocator<U, Propagate>& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    allocation_log* log;
+    int id;
+};
+
+// Shared by every stateless_allocator regardless of value_type
+allocation_log& stateless_log()
+{
+    static allocation_log log;
+    return log;
+}
+
+// Stateless test allocator, every instance shares one log
+template <typename T>
+struct stateless_allocator
+{
+    typedef T value_type;
+
+    stateless_allocator() {}
+
+    template <typename U>
+    stateless_allocator(const stateless_allocator<U>&) {}
+
+    static allocation_log& log() { return stateless_log(); }
+
+    T* allocate(std::size_t n)
+    {
+        log().allocations += static_cast<int>(n);
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t n)
+    {
+        log().deallocations += static_cast<int>(n);
+        ::operator delete(ptr);
+    }
+
+    template <typename U>
+    bool operator==(const stateless_allocator<U>&) const { return true; }
+
+    template <typename U>
+    bool operator!=(const stateless_allocator<U>&) const { return false; }
+};
+
 // Test functor for predicate functions
 struct is_seven
 {
@@ -294,6 +393,88 @@ TEST_CASE("Pushing to elements to the back of the list", "[push_back]")
     }
 }
 
+// Has no default constructor and cannot be copied or moved
+class Immovable
+{
+  public:
+
+    Immovable(int num, const std::string& str)
+        : num(num), str(str) {}
+
+    Immovable(const Immovable&) = delete;
+    Immovable& operator=(const Immovable&) = delete;
+
+    int num;
+    std::string str;
+};
+
+TEST_CASE("Constructing elements in place", "[emplace]")
+{
+    SECTION("Emplacing at the front and back of an empty list")
+    {
+        linear_linked_list<Data> list;
+
+        REQUIRE(list.emplace_front(2, "two").num == 2);
+        REQUIRE(list.emplace_back(3, "three").str == "three");
+        Data& first = list.emplace_front(1, "one");
+
+        REQUIRE(&first == &list.front());
+
+        REQUIRE(list.front() == Data(1, "one"));
+        REQUIRE(list.back() == Data(3, "three"));
+    }
+    SECTION("Emplacing does not move a temporary")
+    {
+        linear_linked_list<Data> list;
+        int moves = Data::move_count;
+
+        list.emplace_back(1, "one");
+        list.emplace_front(0, "zero");
+
+        REQUIRE(Data::move_count == moves);
+    }
+    SECTION("Emplacing after an element in the middle of the list")
+    {
+        linear_linked_list<int> list { 1, 3 };
+
+        linear_linked_list<int>::iterator it = list.emplace_after(list.begin(), 2);
+
+        REQUIRE(*it == 2);
+        REQUIRE(list == linear_linked_list<int> { 1, 2, 3 });
+        REQUIRE(list.back() == 3);
+    }
+    SECTION("Emplacing after the tail updates the tail")
+    {
+        linear_linked_list<int> list { 1 };
+
+        list.emplace_after(list.begin(), 2);
+
+        REQUIRE(list.back() == 2);
+        REQUIRE(list.push_back(3).back() == 3);
+    }
+    SECTION("Emplacing after the end throws")
+    {
+        linear_linked_list<int> list;
+
+        REQUIRE_THROWS_AS(list.emplace_after(list.end(), 1), std::logic_error);
+    }
+    SECTION("Elements need not be default constructible or movable")
+    {
+        linear_linked_list<Immovable> list;
+
+        list.emplace_back(2, "two");
+        list.emplace_front(1, "one");
+        list.emplace_after(list.begin(), 3, "three");
+
+        REQUIRE(list.front().num == 1);
+        REQUIRE(list.back().str == "two");
+        REQUIRE((++list.begin())->num == 3);
+
+        list.pop_front();
+        REQUIRE(list.front().num == 3);
+    }
+}
+
 TEST_CASE("Using swap to reassign data", "[swap]")
 {
     SECTION("An empty list and a populated list")
@@ -357,6 +538,179 @@ TEST_CASE("Using the copy-assignment operator", "[operators], [copy-assignment]"
         REQUIRE(i == 3);
         REQUIRE(old.empty());
     }
+    SECTION("Assigning over a longer list destroys only the surplus nodes")
+    {
+        allocation_log log;
+        linear_linked_list<int, tracking_allocator<int>> origin({ 1, 2, 3 }, &log);
+        linear_linked_list<int, tracking_allocator<int>> list({ 5, 6, 7, 8, 9 }, &log);
+        const int* front = &list.front();
+
+        list = origin;
+
+        REQUIRE(list == origin);
+        REQUIRE(&list.front() == front);
+        REQUIRE(list.back() == 3);
+        REQUIRE(log.allocations == 8);
+        REQUIRE(log.deallocations == 2);
+        REQUIRE(list.push_back(4).size() == 4);
+    }
+    SECTION("Assigning over a shorter list allocates only the extra nodes")
+    {
+        allocation_log log;
+        linear_linked_list<int, tracking_allocator<int>> origin({ 1, 2, 3, 4, 5 }, &log);
+        linear_linked_list<int, tracking_allocator<int>> list({ 8, 9 }, &log);
+        const int* front = &list.front();
+
+        list = origin;
+
+        REQUIRE(list == origin);
+        REQUIRE(&list.front() == front);
+        REQUIRE(list.back() == 5);
+        REQUIRE(log.allocations == 10);
+        REQUIRE(log.deallocations == 0);
+    }
+    SECTION("Assigning an empty list destroys every node")
+    {
+        linear_linked_list<int> list { 1, 2, 3 };
+
+        REQUIRE((list = linear_linked_list<int>()).empty());
+        REQUIRE(list.push_back(4).front() == 4);
+    }
+}
+
+// Copying throws once the countdown of allowed copies reaches zero
+struct fragile
+{
+    fragile(int num) : num(num) {}
+
+    fragile(const fragile& origin) : num(origin.num)
+    {
+        count_down();
+    }
+
+    fragile& operator=(const fragile& origin)
+    {
+        count_down();
+        num = origin.num;
+        return *this;
+    }
+
+    void count_down()
+    {
+        if (copies_left-- == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+    }
+
+    int num;
+    static int copies_left;
+};
+int fragile::copies_left = -1;
+
+TEST_CASE("Assigning ranges of elements", "[assign]")
+{
+    linear_linked_list<int> list { 9, 8, 7 };
+
+    SECTION("Assigning a forward range replaces the elements")
+    {
+        std::vector<int> nums = { 1, 2, 3, 4, 5 };
+
+        list.assign(nums.begin(), nums.end());
+
+        REQUIRE(list == linear_linked_list<int> { 1, 2, 3, 4, 5 });
+        REQUIRE(list.size() == 5);
+        REQUIRE(list.back() == 5);
+        REQUIRE(list.push_back(6).back() == 6);
+    }
+    SECTION("Assigning an input range")
+    {
+        std::istringstream stream("1 2 3");
+
+        list.assign(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+
+        REQUIRE(list == linear_linked_list<int> { 1, 2, 3 });
+        REQUIRE(list.back() == 3);
+    }
+    SECTION("Assigning an initializer list")
+    {
+        REQUIRE(list.assign({ 1, 2 }) == linear_linked_list<int> { 1, 2 });
+        REQUIRE(list.back() == 2);
+    }
+    SECTION("Assigning an empty range empties the list")
+    {
+        std::vector<int> none;
+
+        REQUIRE(list.assign(none.begin(), none.end()).empty());
+        REQUIRE(list.push_front(1).back() == 1);
+    }
+    SECTION("Another list's iterators are a forward range")
+    {
+        linear_linked_list<int> origin { 1, 2, 3 };
+
+        linear_linked_list<int> copy(origin.begin(), origin.end());
+        list.assign(origin.begin(), origin.end());
+
+        REQUIRE(copy == origin);
+        REQUIRE(list == origin);
+    }
+    SECTION("Spare nodes are used before new nodes are allocated")
+    {
+        allocation_log log;
+        linear_linked_list<int, tracking_allocator<int>> tracked(&log);
+        tracked.reserve(2);
+
+        tracked.assign({ 1, 2, 3, 4 });
+
+        REQUIRE(log.allocations == 4);
+        REQUIRE(tracked.size() == 4);
+    }
+    SECTION("A failed copy of an added element leaves the list unchanged")
+    {
+        allocation_log log;
+        std::vector<fragile> origin = { 1, 2, 3, 4, 5 };
+        {
+            linear_linked_list<fragile, tracking_allocator<fragile>> tracked(&log);
+            tracked.emplace_back(7);
+            tracked.emplace_back(8);
+
+            fragile::copies_left = 2;
+            REQUIRE_THROWS_AS(tracked.assign(origin.begin(), origin.end()), 
+                              std::runtime_error);
+            fragile::copies_left = -1;
+
+            REQUIRE(tracked.size() == 2);
+            REQUIRE(tracked.front().num == 7);
+            REQUIRE(tracked.back().num == 8);
+            REQUIRE(tracked.emplace_back(9).num == 9);
+        }
+        REQUIRE(log.deallocations == log.allocations);
+    }
+    SECTION("A failed copy of an input range keeps the elements copied so far")
+    {
+        std::istringstream stream("1 2 3 4");
+        linear_linked_list<fragile> tracked;
+        tracked.emplace_back(7);
+
+        fragile::copies_left = 2;
+        REQUIRE_THROWS_AS(tracked.assign(std::istream_iterator<int>(stream), 
+                                         std::istream_iterator<int>()), 
+                          std::runtime_error);
+        fragile::copies_left = -1;
+
+        REQUIRE(tracked.size() == 2);
+        REQUIRE(tracked.front().num == 1);
+        REQUIRE(tracked.back().num == 2);
+    }
+    SECTION("Assigning an input range over a longer list")
+    {
+        std::istringstream stream("1 2");
+
+        list.assign(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+
+        REQUIRE(list == linear_linked_list<int> { 1, 2 });
+        REQUIRE(list.push_back(3).back() == 3);
+    }
 }
 
 TEST_CASE("Testing equality between lists", "[operators], [equality]")
@@ -483,6 +837,16 @@ TEST_CASE("Erasing elements from a list", "[operations], [erase_after]")
 
         REQUIRE((list.back() == 6) == (*it == 6));
     }
+    SECTION("Erasing the tail moves the tail back")
+    {
+        linear_linked_list<int> short_list { 1, 2 };
+
+        short_list.erase_after(short_list.begin());
+
+        REQUIRE(short_list.back() == 1);
+        REQUIRE(short_list.push_back(3).back() == 3);
+        REQUIRE(short_list.size() == 2);
+    }
 }
 
 TEST_CASE("Removing a specific element from a list", "[operations], [remove]")
@@ -615,6 +979,55 @@ TEST_CASE("Finding the middle point of a list", "[iterators]")
     }
 }
 
+TEST_CASE("Visiting each element with for_each and accumulate", "[for_each], [accumulate]")
+{
+    linear_linked_list<int> list { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+    SECTION("for_each visits the elements in order at any prefetch distance")
+    {
+        const std::size_t distances[] = { 0, 1, 3, 10, 64 };
+        for (std::size_t distance : distances)
+        {
+            std::vector<int> visited;
+            list.for_each([&visited](int num){ visited.push_back(num); }, distance);
+
+            REQUIRE(visited == std::vector<int>({ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 }));
+        }
+    }
+    SECTION("for_each can modify the elements and returns the function")
+    {
+        struct counter
+        {
+            int calls;
+            void operator()(int& num) { num *= 2; ++calls; }
+        };
+
+        counter result = list.for_each(counter{ 0 }, 2);
+
+        REQUIRE(result.calls == 10);
+        REQUIRE(list.front() == 2);
+        REQUIRE(list.back() == 20);
+    }
+    SECTION("accumulate folds the elements from the front")
+    {
+        REQUIRE(list.accumulate(0, [](int sum, int num){ return sum + num; }) == 55);
+        REQUIRE(list.accumulate(0, [](int sum, int num){ return sum * 2 - num; }, 4) 
+                == std::accumulate(list.begin(), list.end(), 0, 
+                                   [](int sum, int num){ return sum * 2 - num; }));
+        REQUIRE(list.accumulate(std::string(), [](std::string str, int num)
+                { 
+                    return str + std::to_string(num); 
+                }, 3) == "12345678910");
+    }
+    SECTION("An empty list returns the initial value")
+    {
+        const linear_linked_list<int> empty;
+
+        REQUIRE(empty.accumulate(7, [](int sum, int num){ return sum + num; }, 8) == 7);
+        empty.for_each([](int){ FAIL("called on an empty list"); }, 8);
+    }
+}
+
 TEST_CASE("Reversing the order of a list", "[reverse]")
 {
     SECTION("Empty list")
@@ -646,6 +1059,28 @@ TEST_CASE("Reversing the order of a list", "[reverse]")
 
 TEST_CASE("Merging two sorted lists", "[merge]")
 {
+    SECTION("An exception from the compare function keeps every node")
+    {
+        linear_linked_list<int> first { 1, 3, 5, 7 };
+        linear_linked_list<int> second { 2, 4, 6, 8 };
+        int comparisons = 0;
+
+        REQUIRE_THROWS_AS(first.merge(second, [&comparisons](int lhs, int rhs)
+        {
+            if (++comparisons == 3)
+            {
+                throw std::runtime_error("compare failed");
+            }
+            return lhs < rhs;
+        }), std::runtime_error);
+
+        REQUIRE(second.empty());
+        REQUIRE(first.size() == 8);
+        REQUIRE(first.push_back(9).back() == 9);
+
+        first.sort();
+        REQUIRE(first == linear_linked_list<int> { 1, 2, 3, 4, 5, 6, 7, 8, 9 });
+    }
     SECTION("Two lists of equal size")
     {
         linear_linked_list<int> first { 1, 3, 5 };
@@ -777,96 +1212,290 @@ TEST_CASE("Merging two sorted lists", "[merge]")
         REQUIRE(first.back() == 2);
         REQUIRE(second.empty());
     }
+    SECTION("Equal elements of this list come first")
+    {
+        linear_linked_list<Data> first { Data(1, "a"), Data(2, "b"), Data(2, "c") };
+        linear_linked_list<Data> second { Data(1, "d"), Data(2, "e"), Data(3, "f") };
+
+        first.merge(second, [](const Data& lhs, const Data& rhs){ return lhs.num < rhs.num; });
+
+        std::string order;
+        for (const Data& data : first)
+        {
+            order += data.str;
+        }
+        REQUIRE(order == "adbcef");
+        REQUIRE(first.back().str == "f");
+    }
 }
 
-TEST_CASE("Splitting lists into smaller lists with iterators", "[split]")
+TEST_CASE("Splicing nodes between lists", "[splice_after], [append], [prepend]")
 {
-    SECTION("Break the head off a populated list")
+    typedef linear_linked_list<int> list_type;
+
+    list_type list { 1, 2, 6 };
+
+    SECTION("Splicing a whole list into the middle")
     {
-        linear_linked_list<int> head { 1, 2, 3, 4, 5, 6 };
-        linear_linked_list<int> tail = head.split(head.begin());
+        list_type other { 3, 4, 5 };
 
-        REQUIRE(head.front() == 1);
+        list.splice_after(++list.begin(), other);
 
-        int i = 1;
-        for(auto num : tail)
-        {
-            REQUIRE(num == ++i);
-        }
+        REQUIRE(list == list_type { 1, 2, 3, 4, 5, 6 });
+        REQUIRE(list.back() == 6);
+        REQUIRE(other.empty());
     }
-    SECTION("Split the list in half")
+    SECTION("Splicing a whole list after the tail")
     {
-        linear_linked_list<int> left { 1, 2, 3, 4, 5, 6, 7 };
-        linear_linked_list<int> right = left.split(left.middle());
+        list_type other { 7, 8 };
+        list_type::iterator last = list.begin();
+        ++(++last);
 
-        REQUIRE(left.back() == 4);
-        
-        int i = 4;
-        for(auto num : right)
-        {
-            REQUIRE(num == ++i);
-        }
+        list.splice_after(last, other);
+
+        REQUIRE(list.back() == 8);
+        REQUIRE(list.push_back(9).size() == 6);
     }
-    SECTION("Split a empty list")
+    SECTION("Splicing an empty list does nothing")
     {
-        linear_linked_list<int> left;
-        linear_linked_list<int> right  = left.split(left.begin());
+        list_type other;
 
-        REQUIRE(left.empty());
-        REQUIRE(right.empty());
+        list.splice_after(list.begin(), other);
+
+        REQUIRE(list == list_type { 1, 2, 6 });
     }
-    SECTION("Splitting a list with one element returns the empty list")
+    SECTION("Splicing after the end throws")
     {
-        linear_linked_list<int> left { 1 };
-        linear_linked_list<int> right = left.split(left.middle());
+        list_type other { 1 };
 
-        REQUIRE(left.front() == 1);
-        REQUIRE(right.empty());
-        REQUIRE_THROWS(right.back());
+        REQUIRE_THROWS_AS(list.splice_after(list.end(), other), std::logic_error);
     }
-    SECTION("Splitting at the end of the list returns the empty list")
+    SECTION("Splicing a range includes last")
     {
-        linear_linked_list<int> left { 1, 2, 3, 4, 5, 6, 7 };
+        list_type other { 0, 3, 4, 5, 10 };
+        list_type::iterator first = other.begin();
+        list_type::iterator last = first;
+        ++(++(++last));
 
-        linear_linked_list<int>::const_iterator it = left.begin();
+        list.splice_after(++list.begin(), other, first, last);
 
-        while(*(it++) != 7);
+        REQUIRE(list == list_type { 1, 2, 3, 4, 5, 6 });
+        REQUIRE(other == list_type { 0, 10 });
+        REQUIRE(other.back() == 10);
+    }
+    SECTION("Splicing a range that ends with the tail of other")
+    {
+        list_type other { 0, 7, 8 };
+        list_type::iterator last = other.begin();
+        ++(++last);
+        list_type::iterator pos = list.begin();
+        ++(++pos);
 
-        linear_linked_list<int> right = left.split(it);
+        list.splice_after(pos, other, other.begin(), last);
 
-        REQUIRE(right.empty());
-        REQUIRE_THROWS(right.back()); // Head and Tail should be NULL and throw an error
-        REQUIRE_THROWS(right.front());
+        REQUIRE(list == list_type { 1, 2, 6, 7, 8 });
+        REQUIRE(list.back() == 8);
+        REQUIRE(other.back() == 0);
+        REQUIRE(other.push_back(1).size() == 2);
     }
-    SECTION("Splitting the list with an end iterator returns the empty list")
+    SECTION("Splicing a range within the same list")
     {
-        linear_linked_list<int> left { 1, 2, 3, 4, 5, 6, 7 };
+        list_type::iterator last = list.begin();
+        ++(++last);
 
-        linear_linked_list<int> right = left.split(left.end());
+        list.splice_after(list.begin(), list, ++list.begin(), last);
 
-        REQUIRE(right.empty());
+        REQUIRE(list == list_type { 1, 6, 2 });
+        REQUIRE(list.back() == 2);
     }
-    SECTION("Splitting the list with an iterator does not modify the iterator")
+    SECTION("Appending and prepending lists")
     {
-        linear_linked_list<int> list { 1, 2, 3, 4, 5 };
+        list.append(list_type { 7, 8 }).prepend(list_type { -1, 0 });
 
-        linear_linked_list<int>::iterator it = list.begin();
-        linear_linked_list<int> split = list.split(it);
+        REQUIRE(list == list_type { -1, 0, 1, 2, 6, 7, 8 });
+        REQUIRE(list.front() == -1);
+        REQUIRE(list.back() == 8);
+    }
+    SECTION("Appending and prepending to an empty list")
+    {
+        list_type empty;
+        empty.append(list_type { 2 }).prepend(list_type { 1 }).append(list_type());
 
-        REQUIRE(*it == (*list.begin() == 1));
+        REQUIRE(empty == list_type { 1, 2 });
+        REQUIRE(empty.back() == 2);
+    }
+    SECTION("Splicing and appending do not allocate")
+    {
+        allocation_log log;
+        tracking_allocator<int> alloc(&log);
+        linear_linked_list<int, tracking_allocator<int>> results(alloc);
+        linear_linked_list<int, tracking_allocator<int>> first({ 1, 2 }, alloc);
+        linear_linked_list<int, tracking_allocator<int>> second({ 3, 4 }, alloc);
+
+        int allocations = log.allocations;
+
+        results.append(std::move(first));
+        results.splice_after(++results.begin(), second);
+
+        REQUIRE(log.allocations == allocations);
+        REQUIRE(results.back() == 4);
     }
 }
 
-TEST_CASE("Sorting lists", "[sort]")
+TEST_CASE("Keeping the element count", "[size]")
 {
-    SECTION("Default sort is to sort into ascending order")
-    {
-        linear_linked_list<int> list { 3, 5, 2, 1, 4, 6 };
+    typedef linear_linked_list<int> list_type;
 
-        list.sort();
+    list_type list { 1, 2, 3, 4, 5, 6 };
 
-        int i = 0;
-        for(auto num : list)
+    SECTION("Pushing, emplacing and popping")
+    {
+        list.push_front(0).push_back(7).pop_front();
+        list.emplace_after(list.begin(), 8);
+
+        REQUIRE(list.size() == 8);
+        REQUIRE(list.clear().size() == 0);
+    }
+    SECTION("Erasing and removing")
+    {
+        list.erase_after(list.begin());
+        list.remove_if([](int num){ return num % 2 == 0; });
+
+        REQUIRE(list.size() == 3);
+    }
+    SECTION("Splitting and merging")
+    {
+        list_type right = list.split(list.middle());
+
+        REQUIRE(list.size() == 3);
+        REQUIRE(right.size() == 3);
+
+        list.merge(right);
+
+        REQUIRE(list.size() == 6);
+        REQUIRE(right.size() == 0);
+    }
+    SECTION("Splicing, appending and prepending")
+    {
+        list_type other { 7, 8, 9, 10 };
+        list_type::iterator last = other.begin();
+        ++(++last);
+
+        list.splice_after(list.begin(), other, other.begin(), last);
+
+        REQUIRE(list.size() == 8);
+        REQUIRE(other.size() == 2);
+
+        list.splice_after(list.begin(), other);
+        list.append(list_type { 11 }).prepend(list_type { 0 });
+
+        REQUIRE(list.size() == 12);
+        REQUIRE(other.size() == 0);
+    }
+    SECTION("Swapping, moving and sorting")
+    {
+        list_type other { 1 };
+        list.swap(other);
+
+        REQUIRE(list.size() == 1);
+        REQUIRE(other.size() == 6);
+
+        list = std::move(other);
+        list.sort().reverse();
+
+        REQUIRE(list.size() == 6);
+        REQUIRE(list_type(std::move(list)).size() == 6);
+    }
+}
+
+TEST_CASE("Splitting lists into smaller lists with iterators", "[split]")
+{
+    SECTION("Break the head off a populated list")
+    {
+        linear_linked_list<int> head { 1, 2, 3, 4, 5, 6 };
+        linear_linked_list<int> tail = head.split(head.begin());
+
+        REQUIRE(head.front() == 1);
+
+        int i = 1;
+        for(auto num : tail)
+        {
+            REQUIRE(num == ++i);
+        }
+    }
+    SECTION("Split the list in half")
+    {
+        linear_linked_list<int> left { 1, 2, 3, 4, 5, 6, 7 };
+        linear_linked_list<int> right = left.split(left.middle());
+
+        REQUIRE(left.back() == 4);
+        
+        int i = 4;
+        for(auto num : right)
+        {
+            REQUIRE(num == ++i);
+        }
+    }
+    SECTION("Split a empty list")
+    {
+        linear_linked_list<int> left;
+        linear_linked_list<int> right  = left.split(left.begin());
+
+        REQUIRE(left.empty());
+        REQUIRE(right.empty());
+    }
+    SECTION("Splitting a list with one element returns the empty list")
+    {
+        linear_linked_list<int> left { 1 };
+        linear_linked_list<int> right = left.split(left.middle());
+
+        REQUIRE(left.front() == 1);
+        REQUIRE(right.empty());
+        REQUIRE_THROWS(right.back());
+    }
+    SECTION("Splitting at the end of the list returns the empty list")
+    {
+        linear_linked_list<int> left { 1, 2, 3, 4, 5, 6, 7 };
+
+        linear_linked_list<int>::const_iterator it = left.begin();
+
+        while(*(it++) != 7);
+
+        linear_linked_list<int> right = left.split(it);
+
+        REQUIRE(right.empty());
+        REQUIRE_THROWS(right.back()); // Head and Tail should be NULL and throw an error
+        REQUIRE_THROWS(right.front());
+    }
+    SECTION("Splitting the list with an end iterator returns the empty list")
+    {
+        linear_linked_list<int> left { 1, 2, 3, 4, 5, 6, 7 };
+
+        linear_linked_list<int> right = left.split(left.end());
+
+        REQUIRE(right.empty());
+    }
+    SECTION("Splitting the list with an iterator does not modify the iterator")
+    {
+        linear_linked_list<int> list { 1, 2, 3, 4, 5 };
+
+        linear_linked_list<int>::iterator it = list.begin();
+        linear_linked_list<int> split = list.split(it);
+
+        REQUIRE(*it == (*list.begin() == 1));
+    }
+}
+
+TEST_CASE("Sorting lists", "[sort]")
+{
+    SECTION("Default sort is to sort into ascending order")
+    {
+        linear_linked_list<int> list { 3, 5, 2, 1, 4, 6 };
+
+        list.sort();
+
+        int i = 0;
+        for(auto num : list)
         {
             REQUIRE(num == ++i);
         }
@@ -895,5 +1524,1066 @@ TEST_CASE("Sorting lists", "[sort]")
             REQUIRE(num == ++i);
         }
     }
+    SECTION("Sorting a reversed list")
+    {
+        linear_linked_list<int> list { 6, 5, 4, 3, 2, 1 };
+
+        list.sort();
+
+        REQUIRE(list == linear_linked_list<int> { 1, 2, 3, 4, 5, 6 });
+        REQUIRE(list.back() == 6);
+    }
+    SECTION("Sorting ascending and descending runs with duplicates")
+    {
+        linear_linked_list<int> list { 1, 4, 4, 7, 9, 8, 3, 3, 2, 5, 6, 0, 9 };
+
+        list.sort();
+
+        REQUIRE(list == linear_linked_list<int> { 0, 1, 2, 3, 3, 4, 4, 5, 6, 7, 8, 9, 9 });
+        REQUIRE(list.back() == 9);
+        REQUIRE(list.push_back(10).back() == 10);
+    }
+    SECTION("Sorting many short runs")
+    {
+        linear_linked_list<int> list;
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.push_back((i * 7919) % 1000);
+        }
+
+        list.sort();
+
+        int i = 0;
+        for(auto num : list)
+        {
+            REQUIRE(num == i++);
+        }
+        REQUIRE(list.back() == 999);
+        REQUIRE(list.size() == 1000);
+    }
+    SECTION("Every strategy sorts long lists")
+    {
+        typedef linear_linked_list<int>::sort_strategy sort_strategy;
+        const int length = static_cast<int>(linear_linked_list<int>::gather_threshold) * 2;
+
+        linear_linked_list<int> shuffled;
+        for (int i = 0; i < length; ++i)
+        {
+            shuffled.push_back((i * 7919) % length);
+        }
+
+        sort_strategy strategies[] = { sort_strategy::automatic, 
+                                       sort_strategy::merge, 
+                                       sort_strategy::gather };
+
+        for (sort_strategy strategy : strategies)
+        {
+            linear_linked_list<int> list = shuffled;
+
+            list.sort(strategy);
+
+            int i = 0;
+            for (auto num : list)
+            {
+                REQUIRE(num == i++);
+            }
+            REQUIRE(list.back() == length - 1);
+            REQUIRE(list.push_back(length).size() == static_cast<std::size_t>(length + 1));
+        }
+    }
+    SECTION("Gather sorting a short list with a custom compare function")
+    {
+        linear_linked_list<int> list { 3, 5, 2, 1, 4, 6 };
+
+        list.sort([](int lhs, int rhs){ return lhs > rhs; }, 
+                  linear_linked_list<int>::sort_strategy::gather);
+
+        REQUIRE(list == linear_linked_list<int> { 6, 5, 4, 3, 2, 1 });
+        REQUIRE(list.back() == 1);
+    }
+    SECTION("An exception from the compare function keeps every node linked")
+    {
+        // Ascending and descending runs, so that the throw lands in a run
+        // being reversed as well as in a merge
+        linear_linked_list<int> shuffled;
+        for (int i = 0; i < 1000; ++i)
+        {
+            shuffled.push_back((i / 10 % 2 == 0) ? i : 1000 - i);
+        }
+        linear_linked_list<int> expected = shuffled;
+        expected.sort();
+
+        for (int throw_at : { 1, 2, 5, 14, 100, 1000, 3000 })
+        {
+            linear_linked_list<int> list = shuffled;
+            int comparisons = 0;
+
+            REQUIRE_THROWS_AS(list.sort([&comparisons, throw_at](int lhs, int rhs)
+            {
+                if (++comparisons == throw_at)
+                {
+                    throw std::runtime_error("compare failed");
+                }
+                return lhs < rhs;
+            }, linear_linked_list<int>::sort_strategy::merge), std::runtime_error);
+
+            // The chain is null terminated at the tail and holds every node
+            std::size_t walked = 0;
+            int last = 0;
+            for (int num : list)
+            {
+                last = num;
+                ++walked;
+            }
+            REQUIRE(walked == shuffled.size());
+            REQUIRE(list.size() == shuffled.size());
+            REQUIRE(list.back() == last);
+
+            list.sort();
+            REQUIRE(list == expected);
+        }
+    }
+}
+
+TEST_CASE("Stable sorting lists", "[stable_sort], [sort_by]")
+{
+    typedef linear_linked_list<Data>::sort_strategy sort_strategy;
+
+    auto by_num = [](const Data& lhs, const Data& rhs){ return lhs.num < rhs.num; };
+
+    // Reads back the tags of the list's elements in order
+    auto tags = [](const linear_linked_list<Data>& list)
+    {
+        std::string order;
+        for (const Data& data : list)
+        {
+            order += data.str;
+        }
+        return order;
+    };
+
+    SECTION("Stable sorting a short list keeps equal elements in order")
+    {
+        linear_linked_list<Data> list { Data(2, "a"), Data(1, "b"), Data(2, "c"), 
+                                        Data(1, "d"), Data(0, "e"), Data(2, "f") };
+
+        list.stable_sort(by_num);
+
+        REQUIRE(tags(list) == "ebdacf");
+        REQUIRE(list.back().str == "f");
+    }
+    SECTION("Descending runs with equal elements are not reordered")
+    {
+        linear_linked_list<Data> list { Data(3, "a"), Data(2, "b"), Data(2, "c"), 
+                                        Data(1, "d"), Data(1, "e") };
+
+        list.sort(by_num, sort_strategy::merge);
+
+        REQUIRE(tags(list) == "debca");
+    }
+    SECTION("Every strategy stable sorts long lists")
+    {
+        const int length = static_cast<int>(linear_linked_list<int>::gather_threshold) * 2;
+
+        // Each key appears twice, tagged with the order it was inserted in
+        linear_linked_list<Data> shuffled;
+        for (int i = 0; i < length; ++i)
+        {
+            shuffled.emplace_back((i * 7919) % (length / 2), i < length / 2 ? "a" : "b");
+        }
+
+        sort_strategy strategies[] = { sort_strategy::automatic, 
+                                       sort_strategy::merge, 
+                                       sort_strategy::gather };
+
+        for (sort_strategy strategy : strategies)
+        {
+            linear_linked_list<Data> list = shuffled;
+
+            list.stable_sort(by_num, strategy);
+
+            int i = 0;
+            for (const Data& data : list)
+            {
+                REQUIRE(data.num == i / 2);
+                REQUIRE(data.str == (i++ % 2 == 0 ? "a" : "b"));
+            }
+            REQUIRE(list.back().num == length / 2 - 1);
+            REQUIRE(list.size() == static_cast<std::size_t>(length));
+        }
+    }
+    SECTION("Stable sorting with the default comparison")
+    {
+        linear_linked_list<int> list { 3, 5, 2, 1, 4, 6 };
+
+        list.stable_sort();
+
+        REQUIRE(list == linear_linked_list<int> { 1, 2, 3, 4, 5, 6 });
+    }
+    SECTION("Sorting by a projection computes each key once")
+    {
+        linear_linked_list<Data> list { Data(0, "pear"), Data(1, "fig"), Data(2, "apple"), 
+                                        Data(3, "kiwi"), Data(4, "plum") };
+        int projections = 0;
+
+        list.sort_by([&projections](const Data& data)
+        { 
+            ++projections;
+            return data.str.size(); 
+        });
+
+        std::vector<int> order;
+        for (const Data& data : list)
+        {
+            order.push_back(data.num);
+        }
+        REQUIRE(order == std::vector<int> { 1, 0, 3, 4, 2 });
+        REQUIRE(projections == 5);
+        REQUIRE(list.back().str == "apple");
+        REQUIRE(list.push_back(Data(5, "lime")).size() == 6);
+    }
+    SECTION("Sorting by a projection with a custom compare function")
+    {
+        linear_linked_list<Data> list { Data(1, "b"), Data(3, "a"), Data(2, "c"), 
+                                        Data(3, "d") };
+
+        list.sort_by([](const Data& data){ return data.num; }, 
+                     [](int lhs, int rhs){ return lhs > rhs; });
+
+        REQUIRE(tags(list) == "adcb");
+    }
+    SECTION("Sorting short and empty lists by a projection")
+    {
+        linear_linked_list<Data> empty;
+        linear_linked_list<Data> single { Data(1, "a") };
+
+        REQUIRE(empty.sort_by([](const Data& data){ return data.str; }).empty());
+        REQUIRE(tags(single.sort_by([](const Data& data){ return data.str; })) == "a");
+    }
+}
+
+TEST_CASE("Radix sorting lists by an integral key", "[sort_by_key]")
+{
+    SECTION("Sorting signed keys orders negative keys first")
+    {
+        linear_linked_list<int> list { 3, -1, 0, -200, 70000, -70000, 5, 2 };
+
+        list.sort_by_key([](int num){ return num; });
+
+        REQUIRE(list == linear_linked_list<int> { -70000, -200, -1, 0, 2, 3, 5, 70000 });
+        REQUIRE(list.back() == 70000);
+        REQUIRE(list.push_back(1).size() == 9);
+    }
+    SECTION("Sorting unsigned 64 bit keys")
+    {
+        typedef unsigned long long ull;
+        linear_linked_list<ull> list { ~0ull, 1ull << 40, 3, 0, 1ull << 63 };
+
+        list.sort_by_key([](ull num){ return num; });
+
+        REQUIRE(list == linear_linked_list<ull> { 0, 3, 1ull << 40, 1ull << 63, ~0ull });
+    }
+    SECTION("Sorting is stable for equal keys")
+    {
+        linear_linked_list<Data> list { Data(2, "a"), Data(1, "b"), Data(2, "c"), 
+                                        Data(1, "d"), Data(-1, "e") };
+
+        list.sort_by_key([](const Data& data){ return data.num; });
+
+        std::string order;
+        for (const Data& data : list)
+        {
+            order += data.str;
+        }
+        REQUIRE(order == "ebdac");
+    }
+    SECTION("Sorting by a char key")
+    {
+        linear_linked_list<char> list { 'd', 'a', 'c', 'b' };
+
+        list.sort_by_key([](char letter){ return letter; });
+
+        REQUIRE(list == linear_linked_list<char> { 'a', 'b', 'c', 'd' });
+    }
+    SECTION("Every strategy sorts long lists stably")
+    {
+        typedef linear_linked_list<Data>::sort_strategy sort_strategy;
+        const int length = static_cast<int>(linear_linked_list<int>::gather_threshold) * 2;
+
+        // Each key appears twice, tagged with the order it was inserted in
+        linear_linked_list<Data> shuffled;
+        for (int i = 0; i < length; ++i)
+        {
+            shuffled.emplace_back((i * 7919) % (length / 2) - length / 4, 
+                                  i < length / 2 ? "first" : "second");
+        }
+
+        sort_strategy strategies[] = { sort_strategy::automatic, 
+                                       sort_strategy::merge, 
+                                       sort_strategy::gather };
+
+        for (sort_strategy strategy : strategies)
+        {
+            linear_linked_list<Data> list = shuffled;
+
+            list.sort_by_key([](const Data& data){ return data.num; }, strategy);
+
+            int i = 0;
+            for (const Data& data : list)
+            {
+                REQUIRE(data.num == i / 2 - length / 4);
+                REQUIRE(data.str == (i++ % 2 == 0 ? "first" : "second"));
+            }
+            REQUIRE(list.back().num == length / 4 - 1);
+            REQUIRE(list.size() == static_cast<std::size_t>(length));
+        }
+    }
+}
+
+TEST_CASE("Sorting lists on several threads", "[parallel_sort]")
+{
+    typedef linear_linked_list<int> list_type;
+
+    // Enough elements for four chunks of the minimum size
+    const int length = static_cast<int>(list_type::parallel_grain) * 4 + 3;
+
+    list_type shuffled;
+    for (int i = 0; i < length; ++i)
+    {
+        shuffled.push_back((i * 7919) % 1000);
+    }
+
+    list_type expected = shuffled;
+    expected.sort();
+
+    SECTION("Every thread count gives the serial result")
+    {
+        for (std::size_t threads = 0; threads <= 5; ++threads)
+        {
+            list_type list = shuffled;
+
+            list.parallel_sort(threads);
+
+            REQUIRE(list == expected);
+            REQUIRE(list.size() == expected.size());
+            REQUIRE(list.back() == expected.back());
+            REQUIRE(list.push_back(1000).back() == 1000);
+        }
+    }
+    SECTION("Sorting with a custom compare function")
+    {
+        list_type list = shuffled;
+
+        list.parallel_sort([](int lhs, int rhs){ return lhs > rhs; }, 3);
+        list.reverse();
+
+        REQUIRE(list == expected);
+    }
+    SECTION("Short lists are sorted on the calling thread")
+    {
+        list_type list { 3, 1, 2 };
+
+        REQUIRE(list.parallel_sort(4) == list_type { 1, 2, 3 });
+    }
+    SECTION("Lists with a custom allocator keep every node")
+    {
+        allocation_log log;
+        linear_linked_list<int, tracking_allocator<int>> 
+            list(shuffled.begin(), shuffled.end(), tracking_allocator<int>(&log));
+
+        int allocations = log.allocations;
+        list.parallel_sort(4);
+
+        REQUIRE(log.allocations == allocations);
+        REQUIRE(list.size() == shuffled.size());
+        REQUIRE(list_type(list.begin(), list.end()) == expected);
+    }
+    SECTION("An exception from the compare function leaves every node in the list")
+    {
+        list_type list = shuffled;
+        std::atomic<int> comparisons(0);
+
+        REQUIRE_THROWS_AS(list.parallel_sort([&comparisons](int lhs, int rhs)
+        { 
+            if (++comparisons == 5000)
+            {
+                throw std::runtime_error("compare failed");
+            }
+            return lhs < rhs;
+        }, 4), std::runtime_error);
+
+        REQUIRE(list.size() == shuffled.size());
+
+        list.sort();
+        REQUIRE(list == expected);
+    }
+    SECTION("An exception during a merge round leaves every node in the list")
+    {
+        std::atomic<int> comparisons(0);
+        auto throwing = [&comparisons](int throw_at)
+        {
+            return [&comparisons, throw_at](int lhs, int rhs)
+            {
+                if (++comparisons == throw_at)
+                {
+                    throw std::runtime_error("compare failed");
+                }
+                return lhs < rhs;
+            };
+        };
+
+        // The merge rounds make the last comparisons, so counting them all
+        // first puts a throw 1000 comparisons before the end in the last round
+        list_type counted = shuffled;
+        counted.parallel_sort(throwing(-1), 4);
+        const int total = comparisons.exchange(0);
+
+        list_type list = shuffled;
+        REQUIRE_THROWS_AS(list.parallel_sort(throwing(total - 1000), 4), std::runtime_error);
+        REQUIRE(list.size() == shuffled.size());
+
+        list.sort();
+        REQUIRE(list == expected);
+    }
+    SECTION("An exception leaves every node in a list with a custom allocator")
+    {
+        typedef linear_linked_list<int, tracking_allocator<int>> tracked_list;
+
+        std::atomic<int> comparisons(0);
+        auto throwing = [&comparisons](int throw_at)
+        {
+            return [&comparisons, throw_at](int lhs, int rhs)
+            {
+                if (++comparisons == throw_at)
+                {
+                    throw std::runtime_error("compare failed");
+                }
+                return lhs < rhs;
+            };
+        };
+
+        allocation_log log;
+        tracked_list counted(shuffled.begin(), shuffled.end(), tracking_allocator<int>(&log));
+        counted.parallel_sort(throwing(-1), 4);
+        const int total = comparisons.exchange(0);
+
+        // The chunks are merge sorted, throw in a chunk sort and in the last
+        // merge round
+        for (int throw_at : { total / 3, total - 1000 })
+        {
+            comparisons = 0;
+            tracked_list list(shuffled.begin(), shuffled.end(), tracking_allocator<int>(&log));
+
+            REQUIRE_THROWS_AS(list.parallel_sort(throwing(throw_at), 4), std::runtime_error);
+            REQUIRE(list.size() == shuffled.size());
+
+            list.sort();
+            REQUIRE(list_type(list.begin(), list.end()) == expected);
+        }
+    }
+}
+
+TEST_CASE("Operations on long lists do not exhaust the stack", "[stack]")
+{
+    // Deep enough to overflow a default sized stack if any operation recurred
+    // once per node
+    const int length = 1000000;
+
+    linear_linked_list<int> list;
+    for (int i = length; i > 0; --i)
+    {
+        list.push_back(i);
+    }
+
+    SECTION("size and middle")
+    {
+        REQUIRE(list.size() == static_cast<std::size_t>(length));
+        REQUIRE(*list.middle() == length / 2 + 1);
+    }
+    SECTION("reverse")
+    {
+        list.reverse();
+
+        REQUIRE(list.front() == 1);
+        REQUIRE(list.back() == length);
+    }
+    SECTION("sort and merge")
+    {
+        linear_linked_list<int> evens;
+        for (int i = 0; i < length; i += 2)
+        {
+            evens.push_back(i);
+        }
+
+        list.sort().merge(evens);
+
+        REQUIRE(list.front() == 0);
+        REQUIRE(list.back() == length);
+        REQUIRE(evens.empty());
+    }
+    SECTION("remove_if")
+    {
+        REQUIRE(list.remove_if([](int n){ return n % 2 == 0; }) == length / 2);
+        REQUIRE(list.size() == static_cast<std::size_t>(length / 2));
+        REQUIRE(list.back() == 1);
+    }
+    SECTION("clear")
+    {
+        REQUIRE(list.clear().empty());
+    }
+}
+
+TEST_CASE("Allocating nodes through a custom allocator", "[allocator]")
+{
+    typedef tracking_allocator<int> allocator;
+    typedef tracking_allocator<int, false> fixed_allocator;
+
+    allocation_log log;
+
+    SECTION("Every node allocated is deallocated through the allocator")
+    {
+        {
+            linear_linked_list<int, allocator> list({ 1, 2, 3, 4, 5 }, &log);
+
+            list.push_front(0).push_back(6).pop_front();
+            list.erase_after(list.begin());
+            list.remove(4);
+
+            REQUIRE(log.allocations == 7);
+            REQUIRE(log.deallocations == 3);
+        }
+        REQUIRE(log.deallocations == log.allocations);
+    }
+    SECTION("Copy construction uses a copy of the origin's allocator")
+    {
+        linear_linked_list<int, allocator> origin({ 1, 2, 3 }, allocator(&log, 1));
+        linear_linked_list<int, allocator> copy(origin);
+
+        REQUIRE(copy == origin);
+        REQUIRE(copy.get_allocator() == origin.get_allocator());
+        REQUIRE(log.allocations == 6);
+    }
+    SECTION("Copy assignment propagates the allocator if the traits allow it")
+    {
+        linear_linked_list<int, allocator> origin({ 1, 2, 3 }, allocator(&log, 1));
+        linear_linked_list<int, allocator> list({ 4 }, allocator(&log, 2));
+
+        list = origin;
+
+        REQUIRE(list == origin);
+        REQUIRE(list.get_allocator().id == 1);
+    }
+    SECTION("Copy assignment keeps its own allocator if the traits forbid it")
+    {
+        linear_linked_list<int, fixed_allocator> origin({ 1, 2, 3 }, fixed_allocator(&log, 1));
+        linear_linked_list<int, fixed_allocator> list({ 4 }, fixed_allocator(&log, 2));
+
+        list = origin;
+
+        REQUIRE(list == origin);
+        REQUIRE(list.get_allocator().id == 2);
+    }
+    SECTION("Move assignment steals the nodes of a propagating allocator")
+    {
+        linear_linked_list<int, allocator> origin({ 1, 2, 3 }, allocator(&log, 1));
+        linear_linked_list<int, allocator> list(allocator(&log, 2));
+
+        list = std::move(origin);
+
+        REQUIRE(list.size() == 3);
+        REQUIRE(list.get_allocator().id == 1);
+        REQUIRE(log.allocations == 3);
+        REQUIRE(origin.empty());
+    }
+    SECTION("Move assignment between unequal allocators moves each element")
+    {
+        linear_linked_list<int, fixed_allocator> origin({ 1, 2, 3 }, fixed_allocator(&log, 1));
+        linear_linked_list<int, fixed_allocator> list(fixed_allocator(&log, 2));
+
+        list = std::move(origin);
+
+        REQUIRE(list.size() == 3);
+        REQUIRE(list.get_allocator().id == 2);
+        REQUIRE(log.allocations == 6);
+        REQUIRE(log.deallocations == 3);
+        REQUIRE(origin.empty());
+    }
+    SECTION("Swap exchanges allocators if the traits allow it")
+    {
+        linear_linked_list<int, allocator> left({ 1 }, allocator(&log, 1));
+        linear_linked_list<int, allocator> right({ 2 }, allocator(&log, 2));
+
+        left.swap(right);
+
+        REQUIRE(left.front() == 2);
+        REQUIRE(left.get_allocator().id == 2);
+        REQUIRE(right.get_allocator().id == 1);
+    }
+}
+
+TEST_CASE("Recycling freed nodes through the node pool", "[reserve], [shrink_to_fit]")
+{
+    typedef tracking_allocator<int> allocator;
+
+    allocation_log log;
+
+    SECTION("Reserved nodes are used before allocating")
+    {
+        linear_linked_list<int, allocator> list(&log);
+
+        list.reserve(3);
+        REQUIRE(log.allocations == 3);
+
+        list.push_back(1).push_back(2).push_front(0);
+        REQUIRE(log.allocations == 3);
+
+        list.push_back(3);
+        REQUIRE(log.allocations == 4);
+    }
+    SECTION("Popped nodes are reused by later pushes")
+    {
+        linear_linked_list<int, allocator> list(&log);
+        list.reserve(1);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            REQUIRE(list.push_back(i).front() == i);
+            list.pop_front();
+        }
+
+        REQUIRE(list.empty());
+        REQUIRE(log.allocations == 1);
+        REQUIRE(log.deallocations == 0);
+    }
+    SECTION("Erased, removed and cleared nodes are recycled")
+    {
+        linear_linked_list<int, allocator> list(&log);
+        list.reserve(6);
+        list.push_back(1).push_back(2).push_back(3)
+            .push_back(4).push_back(5).push_back(6);
+
+        list.erase_after(list.begin());
+        list.remove_if([](int n){ return n > 4; });
+        list.clear();
+
+        REQUIRE(log.deallocations == 0);
+
+        list.push_back(1).push_back(2).push_back(3);
+        REQUIRE(log.allocations == 6);
+    }
+    SECTION("The pool keeps at most the reserved number of nodes")
+    {
+        linear_linked_list<int, allocator> list({ 1, 2, 3, 4 }, &log);
+        list.reserve(2);
+
+        list.clear();
+
+        REQUIRE(log.allocations == 6);
+        REQUIRE(log.deallocations == 4);
+    }
+    SECTION("shrink_to_fit frees pooled nodes and stops recycling")
+    {
+        linear_linked_list<int, allocator> list({ 1, 2, 3 }, &log);
+        list.reserve(2);
+        list.pop_front();
+
+        list.shrink_to_fit();
+        REQUIRE(log.deallocations == 3);
+
+        list.pop_front();
+        REQUIRE(log.deallocations == 4);
+    }
+    SECTION("Destruction frees the pooled nodes")
+    {
+        {
+            linear_linked_list<int, allocator> list({ 1, 2, 3 }, &log);
+            list.reserve(8);
+        }
+        REQUIRE(log.allocations == 11);
+        REQUIRE(log.deallocations == 11);
+    }
+    SECTION("Pooled nodes can hold non-trivial data")
+    {
+        linear_linked_list<Data> list;
+        list.reserve(2);
+
+        list.push_back(Data(1, "one")).push_back(Data(2, "two"));
+        list.pop_front().pop_front();
+        list.push_back(Data(3, "three"));
+
+        REQUIRE(list.front() == Data(3, "three"));
+    }
+}
+
+TEST_CASE("Sharing freed nodes through the thread cache", "[thread_cache]")
+{
+    typedef linear_linked_list<int, stateless_allocator<int>> list_type;
+
+    allocation_log& log = stateless_allocator<int>::log();
+    log = allocation_log();
+
+    SECTION("Nodes are not cached unless the thread opts in")
+    {
+        {
+            list_type list { 1, 2, 3 };
+        }
+        REQUIRE(log.deallocations == 3);
+    }
+    SECTION("A destroyed list's nodes are reused by the next list")
+    {
+        list_type::reserve_thread_cache(4);
+        REQUIRE(log.allocations == 4);
+
+        {
+            list_type list { 1, 2, 3, 4 };
+        }
+        {
+            list_type list { 5, 6, 7 };
+            list.push_front(4).pop_front();
+            list.clear();
+        }
+        REQUIRE(log.allocations == 4);
+        REQUIRE(log.deallocations == 0);
+
+        list_type::release_thread_cache();
+        REQUIRE(log.deallocations == 4);
+    }
+    SECTION("The cache keeps at most the reserved number of nodes")
+    {
+        list_type::reserve_thread_cache(2);
+        {
+            list_type list { 1, 2, 3, 4, 5 };
+        }
+        REQUIRE(log.allocations == 5);
+        REQUIRE(log.deallocations == 3);
+
+        list_type::release_thread_cache();
+        REQUIRE(log.deallocations == 5);
+    }
+    SECTION("A list's pool is handed to the cache when the list is destroyed")
+    {
+        list_type::reserve_thread_cache(3);
+        {
+            list_type list;
+            list.reserve(3);
+        }
+        REQUIRE(log.allocations == 6);
+        REQUIRE(log.deallocations == 3);
+
+        list_type::release_thread_cache();
+    }
+    SECTION("Each thread has its own cache")
+    {
+        list_type::reserve_thread_cache(3);
+
+        std::thread worker([]()
+        {
+            list_type list { 1, 2, 3 };
+        });
+        worker.join();
+
+        REQUIRE(log.allocations == 6);
+        REQUIRE(log.deallocations == 3);
+
+        list_type::release_thread_cache();
+    }
+    SECTION("Lists destroyed after the thread's cache free their nodes")
+    {
+        std::thread worker([]()
+        {
+            // Constructed before the cache, so destroyed after it at exit
+            static thread_local list_type late { 1, 2, 3 };
+
+            list_type::reserve_thread_cache(2);
+            late.push_front(0);
+        });
+        worker.join();
+
+        // push_front took a cached node, none is allocated or lost
+        REQUIRE(log.allocations == 5);
+        REQUIRE(log.deallocations == 5);
+    }
+    SECTION("Releasing a cache that was never reserved does nothing")
+    {
+        list_type::release_thread_cache();
+        {
+            list_type list { 1, 2 };
+        }
+        REQUIRE(log.deallocations == 2);
+    }
+}
+
+#ifdef LINKED_LIST_STATISTICS
+
+// Only the statistics test case makes lists of this type
+struct counted_element
+{
+    counted_element(int value = 0) : value(value) {}
+    long long value;
+};
+
+TEST_CASE("Counting nodes with statistics", "[statistics]")
+{
+    typedef linear_linked_list<int, tracking_allocator<int>> list_type;
+
+    allocation_log log;
+
+    SECTION("Allocations and frees match the allocator's calls")
+    {
+        list_type list({ 1, 2, 3, 4 }, &log);
+        list.reserve(2);
+        list.pop_front().pop_front().pop_front();
+        list.shrink_to_fit();
+
+        list_type::statistics stats = list.stats();
+        REQUIRE(stats.nodes_allocated == log.allocations);
+        REQUIRE(stats.nodes_freed == log.deallocations);
+        REQUIRE(stats.live_nodes == 1);
+        REQUIRE(stats.peak_live_nodes == 6);
+        REQUIRE(stats.bytes_per_node >= sizeof(int) + sizeof(void*));
+    }
+    SECTION("Spliced and swapped nodes count towards the receiving list")
+    {
+        list_type list({ 1, 2 }, &log);
+        list_type other({ 3, 4, 5 }, &log);
+
+        list.append(std::move(other));
+        REQUIRE(list.stats().live_nodes == 5);
+        REQUIRE(list.stats().peak_live_nodes == 5);
+        REQUIRE(list.stats().nodes_allocated == 2);
+
+        list_type split = list.split(list.begin());
+        REQUIRE(split.stats().peak_live_nodes == 4);
+        REQUIRE(list.stats().live_nodes == 1);
+    }
+    SECTION("Counts are aggregated over every list of a type")
+    {
+        typedef linear_linked_list<counted_element> counted_list;
+        const counted_list::statistics before = counted_list::type_stats();
+
+        {
+            counted_list first { 1, 2, 3 };
+            counted_list second { 4, 5 };
+            first.pop_front();
+
+            const counted_list::statistics during = counted_list::type_stats();
+            REQUIRE(during.nodes_allocated - before.nodes_allocated == 5);
+            REQUIRE(during.nodes_freed - before.nodes_freed == 1);
+            REQUIRE(during.live_nodes - before.live_nodes == 4);
+            REQUIRE(during.peak_live_nodes >= 5);
+        }
+
+        const counted_list::statistics after = counted_list::type_stats();
+        REQUIRE(after.live_nodes == before.live_nodes);
+        REQUIRE(after.bytes_per_node == sizeof(counted_element) * 2);
+    }
+}
+
+#endif // LINKED_LIST_STATISTICS
+
+#ifdef LINKED_LIST_PROFILING
+
+// Only the profiling test case makes lists of this type
+struct profiled_element
+{
+    profiled_element(int value = 0) : value(value) {}
+    bool operator==(const profiled_element& rhs) const { return value == rhs.value; }
+    bool operator!=(const profiled_element& rhs) const { return value != rhs.value; }
+    bool operator<(const profiled_element& rhs) const { return value < rhs.value; }
+    int value;
+};
+
+TEST_CASE("Counting node hops per operation", "[profiling]")
+{
+    typedef linear_linked_list<profiled_element> list_type;
+    typedef list_type::operation operation;
+
+    list_type::reset_profile();
+
+    list_type list { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+    SECTION("Each call is counted with its hops")
+    {
+        list.middle();
+        list.middle();
+
+        list_type::operation_profile middle = list_type::profile(operation::middle);
+        REQUIRE(middle.calls == 2);
+        REQUIRE(middle.hops > 0);
+        REQUIRE(list_type::profile(operation::sort).calls == 0);
+    }
+    SECTION("Calls are bucketed by the power of two of their hops")
+    {
+        list_type copy(list);
+
+        // Copying follows the origin's next pointers, 8 hops lands in bucket 4
+        list_type::operation_profile copied = list_type::profile(operation::copy);
+        REQUIRE(copied.calls == 1);
+        REQUIRE(copied.hops == 8);
+        REQUIRE(copied.histogram[4] == 1);
+    }
+    SECTION("Operations called inside another are part of it")
+    {
+        list_type other { 1, 2, 3, 4, 5, 6, 7, 8 };
+        list.remove(profiled_element(3));
+
+        // Lists of different sizes compare unequal without walking either
+        REQUIRE_FALSE(list == other);
+
+        REQUIRE(list_type::profile(operation::remove).calls == 1);
+        REQUIRE(list_type::profile(operation::remove_if).calls == 0);
+
+        list_type::operation_profile equality = list_type::profile(operation::equality);
+        REQUIRE(equality.calls == 1);
+        REQUIRE(equality.histogram[0] == 1);
+    }
+    SECTION("Worker threads count their hops as part of parallel_sort")
+    {
+        list_type large;
+        for (int i = 0; i < 4 * static_cast<int>(list_type::parallel_grain); ++i)
+        {
+            large.push_front(profiled_element(i));
+        }
+        list_type::reset_profile();
+
+        large.parallel_sort(std::less<profiled_element>(), 4);
+
+        // Cutting the list into chunks alone follows every next pointer
+        list_type::operation_profile sorted = list_type::profile(operation::parallel_sort);
+        REQUIRE(sorted.calls == 1);
+        REQUIRE(sorted.hops > large.size());
+        REQUIRE(list_type::profile(operation::sort).calls == 0);
+        REQUIRE(list_type::profile(operation::merge).calls == 0);
+    }
+    SECTION("Operations are named")
+    {
+        REQUIRE(std::string(list_type::operation_name(operation::sort_by_key)) == "sort_by_key");
+        REQUIRE(std::string(list_type::operation_name(operation::equality)) == "equality");
+    }
+}
+
+#endif // LINKED_LIST_PROFILING
+
+#ifdef LINKED_LIST_HAS_PMR
+
+// Monotonic resource that counts the deallocations it is asked to ignore
+class counting_monotonic_resource : public std::pmr::monotonic_buffer_resource
+{
+  public:
+
+    int allocations = 0;
+    int deallocations = 0;
+
+  protected:
+
+    void* do_allocate(std::size_t bytes, std::size_t align) override
+    {
+        ++allocations;
+        return std::pmr::monotonic_buffer_resource::do_allocate(bytes, align);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t align) override
+    {
+        ++deallocations;
+        std::pmr::monotonic_buffer_resource::do_deallocate(ptr, bytes, align);
+    }
+};
+
+// General purpose resource that counts the deallocations it performs
+class counting_resource : public std::pmr::memory_resource
+{
+  public:
+
+    int deallocations = 0;
+
+  protected:
+
+    void* do_allocate(std::size_t bytes, std::size_t align) override
+    {
+        return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t align) override
+    {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+TEST_CASE("Allocating nodes from a polymorphic memory resource", "[pmr]")
+{
+    counting_monotonic_resource arena;
+
+    SECTION("Nodes are allocated from the memory resource")
+    {
+        pmr::linear_linked_list<int> list(&arena);
+        list.push_back(1).push_back(2);
+
+        REQUIRE(list.get_allocator().resource() == &arena);
+        REQUIRE(list.front() == 1);
+    }
+    SECTION("A monotonic resource skips per node deallocation on clear")
+    {
+        pmr::linear_linked_list<int> list({ 1, 2, 3, 4 }, &arena);
+
+        REQUIRE(list.clear().empty());
+        REQUIRE(arena.deallocations == 0);
+
+        REQUIRE(list.push_back(5).front() == 5);
+    }
+    SECTION("A monotonic resource skips per node deallocation on destruction")
+    {
+        {
+            pmr::linear_linked_list<std::string> list({ "a", "b", "c" }, &arena);
+            list.reserve(2);
+        }
+        REQUIRE(arena.deallocations == 0);
+    }
+    SECTION("A monotonic resource allocates copied nodes in one block")
+    {
+        pmr::linear_linked_list<int> origin({ 1, 2, 3, 4 }, &arena);
+        int allocations = arena.allocations;
+
+        pmr::linear_linked_list<int> copy(origin, &arena);
+
+        REQUIRE(arena.allocations == allocations + 1);
+        REQUIRE(copy == origin);
+
+        // Consecutive elements are one node apart
+        std::vector<const char*> addresses;
+        for (const int& num : copy)
+        {
+            addresses.push_back(reinterpret_cast<const char*>(&num));
+        }
+        REQUIRE(addresses[1] - addresses[0] > 0);
+        REQUIRE(addresses[2] - addresses[1] == addresses[1] - addresses[0]);
+        REQUIRE(addresses[3] - addresses[2] == addresses[1] - addresses[0]);
+    }
+    SECTION("Element destructors still run when deallocation is skipped")
+    {
+        std::shared_ptr<int> shared = std::make_shared<int>(7);
+        {
+            pmr::linear_linked_list<std::shared_ptr<int>> list(&arena);
+            list.push_back(shared).push_back(shared);
+
+            REQUIRE(shared.use_count() == 3);
+        }
+        REQUIRE(shared.use_count() == 1);
+    }
+    SECTION("Other resources deallocate each node")
+    {
+        counting_resource resource;
+        {
+            pmr::linear_linked_list<int> list({ 1, 2, 3 }, &resource);
+            list.clear().push_back(4);
+        }
+        REQUIRE(resource.deallocations == 4);
+    }
 }
 
+#endif // LINKED_LIST_HAS_PMR
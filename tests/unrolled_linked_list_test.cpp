@@ -0,0 +1,395 @@
+/*
+
+ File: unrolled_linked_list_test.cpp
+
+ Brief: Unit tests for unrolled linked list data structure. Most tests use
+        nodes of three elements so that operations cross node boundaries.
+
+ Copyright (c) 2018 Alexander DuPree
+
+ This software is released as open source through the MIT License
+
+ Authors: Alexander DuPree
+
+ https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <catch.hpp>
+#include "unrolled_linked_list.hpp"
+
+typedef unrolled_linked_list<int, 3> small_list;
+
+// Walks the list and checks it holds the sequence first, first + 1, ...
+template <class List>
+bool is_sequence(const List& list, int first, int last)
+{
+    int expected = first;
+    for (int num : list)
+    {
+        if (num != expected++)
+        {
+            return false;
+        }
+    }
+    return expected == last + 1;
+}
+
+TEST_CASE("Constructing unrolled_linked_list objects", "[unrolled], [constructors]")
+{
+    SECTION("Default construction")
+    {
+        small_list list;
+
+        REQUIRE(list.empty());
+        REQUIRE(list.size() == 0);
+    }
+    SECTION("Initializer list construction spanning several nodes")
+    {
+        small_list list { 1, 2, 3, 4, 5, 6, 7 };
+
+        REQUIRE(list.size() == 7);
+        REQUIRE(is_sequence(list, 1, 7));
+    }
+    SECTION("Ranged based construction with a standard container")
+    {
+        std::vector<int> nums = { 1, 2, 3, 4, 5 };
+
+        small_list list(nums.begin(), nums.end());
+
+        REQUIRE(is_sequence(list, 1, 5));
+    }
+    SECTION("Copy construction")
+    {
+        small_list origin { 1, 2, 3, 4, 5 };
+        small_list copy(origin);
+
+        REQUIRE(copy == origin);
+    }
+    SECTION("Move construction")
+    {
+        small_list origin { 1, 2, 3, 4, 5 };
+        small_list moved(std::move(origin));
+
+        REQUIRE(is_sequence(moved, 1, 5));
+        REQUIRE(origin.empty());
+    }
+    SECTION("The default node capacity holds small types")
+    {
+        unrolled_linked_list<char> list { 'a', 'b', 'c' };
+
+        REQUIRE(list.front() == 'a');
+        REQUIRE(list.back() == 'c');
+    }
+}
+
+TEST_CASE("Pushing and popping elements of an unrolled list", "[unrolled], [push], [pop_front]")
+{
+    small_list list;
+
+    SECTION("Pushing to the front fills nodes from the back")
+    {
+        for (int i = 7; i > 0; --i)
+        {
+            list.push_front(i);
+        }
+
+        REQUIRE(list.size() == 7);
+        REQUIRE(is_sequence(list, 1, 7));
+    }
+    SECTION("Pushing to both ends")
+    {
+        list.push_back(4).push_front(3).push_back(5).push_front(2)
+            .push_front(1).push_back(6);
+
+        REQUIRE(is_sequence(list, 1, 6));
+        REQUIRE(list.front() == 1);
+        REQUIRE(list.back() == 6);
+    }
+    SECTION("Popping every element frees every node")
+    {
+        list = small_list { 1, 2, 3, 4, 5 };
+
+        int out = 0;
+        for (int i = 1; i <= 5; ++i)
+        {
+            REQUIRE(list.pop_front(out) == i);
+        }
+
+        REQUIRE(list.empty());
+        REQUIRE_THROWS(list.front());
+        REQUIRE_THROWS(list.back());
+
+        REQUIRE(list.push_back(1).back() == 1);
+    }
+    SECTION("Elements with resources are moved and destroyed")
+    {
+        unrolled_linked_list<std::string, 2> strings;
+        std::string word = "unrolled";
+
+        strings.push_back(std::move(word)).push_back("list").push_front("an");
+        strings.pop_front();
+
+        REQUIRE(word.empty());
+        REQUIRE(strings.front() == "unrolled");
+        REQUIRE(strings.back() == "list");
+    }
+}
+
+TEST_CASE("Erasing and removing from an unrolled list", "[unrolled], [erase_after], [remove_if]")
+{
+    small_list list { 1, 2, 10, 3, 4, 10, 5, 6, 10 };
+
+    SECTION("Erasing an element in the same node")
+    {
+        small_list::iterator it = list.begin();
+        ++it;
+
+        list.erase_after(it);
+        list.erase_after(list.begin());
+
+        REQUIRE(list.front() == 1);
+        REQUIRE(*(++list.begin()) == 3);
+        REQUIRE(list.size() == 7);
+    }
+    SECTION("Erasing the first element of the next node")
+    {
+        small_list::iterator it = list.begin();
+        ++(++it);
+
+        list.erase_after(it);
+
+        REQUIRE(*(++it) == 4);
+    }
+    SECTION("Erasing the tail moves the tail back")
+    {
+        small_list short_list { 1, 2, 3, 4 };
+        small_list::iterator it = short_list.begin();
+        ++(++it);
+
+        short_list.erase_after(it);
+
+        REQUIRE(short_list.back() == 3);
+        REQUIRE(short_list.push_back(4).back() == 4);
+        REQUIRE(is_sequence(short_list, 1, 4));
+    }
+    SECTION("remove_if packs the remaining elements")
+    {
+        REQUIRE(list.remove(10) == 3);
+        REQUIRE(list.size() == 6);
+        REQUIRE(is_sequence(list, 1, 6));
+        REQUIRE(list.back() == 6);
+        REQUIRE(list.push_back(7).back() == 7);
+    }
+    SECTION("remove_if on every element empties the list")
+    {
+        REQUIRE(list.remove_if([](int){ return true; }) == 9);
+        REQUIRE(list.empty());
+    }
+    SECTION("remove_if with no matching element")
+    {
+        REQUIRE(list.remove(42) == 0);
+        REQUIRE(list.size() == 9);
+    }
+    SECTION("remove_if on a front filled node")
+    {
+        small_list front_filled;
+        front_filled.push_front(3).push_front(2).push_front(1).push_back(4);
+
+        REQUIRE(front_filled.remove(1) == 1);
+        REQUIRE(is_sequence(front_filled, 2, 4));
+    }
+}
+
+TEST_CASE("Reversing, sorting and merging unrolled lists", "[unrolled], [sort], [merge], [reverse]")
+{
+    SECTION("Reversing a list")
+    {
+        small_list list { 7, 6, 5, 4, 3, 2, 1 };
+
+        list.reverse();
+
+        REQUIRE(is_sequence(list, 1, 7));
+        REQUIRE(list.back() == 7);
+    }
+    SECTION("Sorting into ascending order")
+    {
+        small_list list { 3, 5, 2, 7, 1, 4, 6 };
+
+        list.sort();
+
+        REQUIRE(is_sequence(list, 1, 7));
+    }
+    SECTION("Sorting with a custom compare function")
+    {
+        small_list list { 3, 5, 2, 1, 4, 6 };
+
+        list.sort([](int lhs, int rhs){ return lhs > rhs; });
+
+        list.reverse();
+        REQUIRE(is_sequence(list, 1, 6));
+    }
+    SECTION("An exception from the compare function leaves the list unchanged")
+    {
+        unrolled_linked_list<std::string, 3> list;
+        for (int i = 20; i > 0; --i)
+        {
+            list.push_back("a string too long for small string storage " + std::to_string(i));
+        }
+        const unrolled_linked_list<std::string, 3> original(list);
+
+        int calls = 0;
+        REQUIRE_THROWS_AS(list.sort([&calls](const std::string& lhs, const std::string& rhs)
+        {
+            if (++calls == 10)
+            {
+                throw std::runtime_error("compare failed");
+            }
+            return lhs < rhs;
+        }), std::runtime_error);
+
+        REQUIRE(list == original);
+    }
+    SECTION("Merging two sorted lists")
+    {
+        small_list first { 1, 3, 5, 7, 9 };
+        small_list second { 2, 4, 6, 8, 10, 11, 12 };
+
+        first.merge(second);
+
+        REQUIRE(is_sequence(first, 1, 12));
+        REQUIRE(first.back() == 12);
+        REQUIRE(second.empty());
+    }
+    SECTION("Merging into an empty list")
+    {
+        small_list first;
+        small_list second { 1, 2, 3, 4 };
+
+        first.merge(second);
+
+        REQUIRE(is_sequence(first, 1, 4));
+        REQUIRE(second.empty());
+    }
+    SECTION("Merging keeps this list's element before an equivalent one")
+    {
+        typedef std::pair<int, char> tagged;
+        unrolled_linked_list<tagged, 3> first { { 1, 'a' }, { 2, 'a' } };
+        unrolled_linked_list<tagged, 3> second { { 1, 'b' }, { 2, 'b' } };
+
+        first.merge(second, [](const tagged& lhs, const tagged& rhs)
+        {
+            return lhs.first < rhs.first;
+        });
+
+        REQUIRE(first == unrolled_linked_list<tagged, 3> { { 1, 'a' }, { 1, 'b' }, 
+                                                           { 2, 'a' }, { 2, 'b' } });
+    }
+    SECTION("An exception from the compare function loses no element")
+    {
+        small_list first { 1, 3, 5, 7, 9 };
+        small_list second { 2, 4, 6, 8 };
+
+        int calls = 0;
+        REQUIRE_THROWS_AS(first.merge(second, [&calls](int lhs, int rhs)
+        {
+            if (++calls == 4)
+            {
+                throw std::runtime_error("compare failed");
+            }
+            return lhs < rhs;
+        }), std::runtime_error);
+
+        // The three merged elements lead this list, the rest stay in place
+        REQUIRE(first == small_list { 1, 2, 3, 5, 7, 9 });
+        REQUIRE(second == small_list { 4, 6, 8 });
+        REQUIRE(first.back() == 9);
+    }
+}
+
+TEST_CASE("Splitting unrolled lists", "[unrolled], [split]")
+{
+    small_list left { 1, 2, 3, 4, 5, 6, 7 };
+
+    SECTION("Splitting inside a node")
+    {
+        small_list right = left.split(left.begin());
+
+        REQUIRE(is_sequence(left, 1, 1));
+        REQUIRE(is_sequence(right, 2, 7));
+        REQUIRE(right.back() == 7);
+    }
+    SECTION("Splitting at a node boundary")
+    {
+        small_list::iterator it = left.begin();
+        ++(++it);
+
+        small_list right = left.split(it);
+
+        REQUIRE(is_sequence(left, 1, 3));
+        REQUIRE(is_sequence(right, 4, 7));
+    }
+    SECTION("Splitting the list in half")
+    {
+        small_list right = left.split(left.middle());
+
+        REQUIRE(left.back() == 4);
+        REQUIRE(is_sequence(right, 5, 7));
+    }
+    SECTION("Splitting at the last element returns the empty list")
+    {
+        small_list::iterator it = left.begin();
+        while (*it != 7) { ++it; }
+
+        small_list right = left.split(it);
+
+        REQUIRE(right.empty());
+        REQUIRE(left.size() == 7);
+    }
+    SECTION("Splitting with an end iterator returns the empty list")
+    {
+        REQUIRE(left.split(left.end()).empty());
+    }
+}
+
+TEST_CASE("Assigning and comparing unrolled lists", "[unrolled], [operators]")
+{
+    small_list list { 1, 2, 3, 4 };
+
+    SECTION("Copy assignment")
+    {
+        small_list copy;
+
+        REQUIRE((copy = list) == list);
+    }
+    SECTION("Self assignment does nothing")
+    {
+        REQUIRE((list = list) == list);
+    }
+    SECTION("Lists with matching elements in different layouts are equal")
+    {
+        small_list front_filled;
+        front_filled.push_front(4).push_front(3).push_front(2).push_front(1);
+
+        REQUIRE(front_filled == list);
+    }
+    SECTION("Lists with different elements are not equal")
+    {
+        REQUIRE(list != small_list { 1, 2, 3, 5 });
+        REQUIRE(list != small_list { 1, 2, 3 });
+    }
+    SECTION("Mutable iterators modify the elements in place")
+    {
+        for (int& num : list)
+        {
+            num += 1;
+        }
+
+        REQUIRE(is_sequence(list, 2, 5));
+    }
+}
+